@@ -1376,6 +1376,17 @@ class V8_EXPORT Isolate {
    */
   void UpdateLoadStartTime();
 
+  /**
+   * Optional notification to tell V8 the main-thread pause budget of the
+   * embedder. Incremental garbage collection steps performed on the main
+   * thread are sized to stay within |max_pause_in_ms|, and steps triggered by
+   * allocation are spaced out such that the mutator gets at least
+   * |target_utilization| (in [0, 1)) of the main thread time in between.
+   * Passing 0 for both values restores the default heuristics. This is a hint;
+   * atomic pauses may still exceed the budget.
+   */
+  void SetGCPauseBudget(double max_pause_in_ms, double target_utilization);
+
   /**
    * Optional notification to tell V8 the current isolate is used for debugging
    * and requires higher heap limit.
@@ -59,6 +59,9 @@ struct GarbageCollectionFullCycle {
 struct GarbageCollectionFullMainThreadIncrementalMark {
   int64_t wall_clock_duration_in_us = -1;
   int64_t cpp_wall_clock_duration_in_us = -1;
+  // Set if the step took longer than the budget set via
+  // v8::Isolate::SetGCPauseBudget.
+  bool exceeded_pause_budget = false;
 };
 
 struct GarbageCollectionFullMainThreadIncrementalSweep {
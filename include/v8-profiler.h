@@ -24,6 +24,7 @@ enum class EmbedderStateTag : uint8_t;
 class HeapGraphNode;
 struct HeapStatsUpdate;
 class Object;
+class OutputStream;
 enum StateTag : int;
 
 using NativeObject = void*;
@@ -182,6 +183,10 @@ class V8_EXPORT CpuProfileNode {
  */
 class V8_EXPORT CpuProfile {
  public:
+  enum SerializationFormat {
+    kPprof = 0  // See format description near 'Serialize' method.
+  };
+
   /** Returns CPU profile title. */
   Local<String> GetTitle() const;
 
@@ -194,6 +199,13 @@ class V8_EXPORT CpuProfile {
    */
   int GetSamplesCount() const;
 
+  /**
+   * Returns the number of stack samples that were taken while this profile was
+   * being recorded but were dropped because the profiler thread could not keep
+   * up with the sampling rate.
+   */
+  unsigned GetDroppedSamplesCount() const;
+
   /**
    * Returns profile node corresponding to the top frame the sample at
    * the given index.
@@ -235,6 +247,25 @@ class V8_EXPORT CpuProfile {
    * All pointers to nodes previously returned become invalid.
    */
   void Delete();
+
+  /**
+   * Prepare a serialized representation of the profile. The result is written
+   * into the stream provided in chunks of specified size.
+   *
+   * For the pprof format, the stream receives a binary, uncompressed
+   * perftools.profiles.Profile protocol buffer message as defined in
+   * https://github.com/google/pprof/blob/main/proto/profile.proto through
+   * OutputStream::WriteBinaryChunk, which the stream must override. Every
+   * node of the top down tree becomes a location, and every node with self
+   * ticks becomes a sample carrying a "samples" count and a "cpu" time value.
+   *
+   * To export profiles continuously, start the next profile before stopping
+   * the current one. As long as one profile is active, the sampler keeps
+   * running and the code map is retained, so cutting a profile does not
+   * stall the isolate.
+   */
+  void Serialize(OutputStream* stream,
+                 SerializationFormat format = kPprof) const;
 };
 
 enum CpuProfilingMode {
@@ -602,6 +633,15 @@ class V8_EXPORT OutputStream {
   virtual WriteResult WriteHeapStatsChunk(HeapStatsUpdate* data, int count) {
     return kAbort;
   }
+  /**
+   * Writes the next chunk of binary data, which may contain any byte value
+   * including NUL, into the stream. Writing can be stopped by returning
+   * kAbort as function result. EndOfStream will not be called in case
+   * writing was aborted. Streams that do not override this method abort.
+   */
+  virtual WriteResult WriteBinaryChunk(const uint8_t* data, int size) {
+    return kAbort;
+  }
 };
 
 /**
@@ -133,6 +133,29 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Size of the heap shared with other isolates, e.g. for the shared string
+   * table. The shared heap is not included in total_heap_size() and
+   * used_heap_size(), and it is reported by every isolate attached to it.
+   */
+  size_t total_shared_heap_size() { return total_shared_heap_size_; }
+  size_t used_shared_heap_size() { return used_shared_heap_size_; }
+
+  /**
+   * Memory of freed array buffer backing stores that is kept for reuse by
+   * later allocations, and the number of allocations served from it. Both are
+   * 0 unless pooling is enabled with --array-buffer-pool-size.
+   */
+  size_t pooled_array_buffer_memory() { return pooled_array_buffer_memory_; }
+  size_t pooled_array_buffer_hits() { return pooled_array_buffer_hits_; }
+
+  /**
+   * Memory of freed zone segments that is kept for reuse by later compilation
+   * jobs. This is 0 unless pooling is enabled with --zone-segment-pool-size.
+   * The memory is also included in malloced_memory().
+   */
+  size_t pooled_zone_memory() { return pooled_zone_memory_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -154,6 +177,11 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t total_shared_heap_size_;
+  size_t used_shared_heap_size_;
+  size_t pooled_array_buffer_memory_;
+  size_t pooled_array_buffer_hits_;
+  size_t pooled_zone_memory_;
 
   friend class V8;
   friend class Isolate;
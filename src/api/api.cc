@@ -77,6 +77,7 @@
 #include "src/logging/tracing-flags.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/api-callbacks.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/contexts.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
@@ -6182,7 +6183,12 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      total_shared_heap_size_(0),
+      used_shared_heap_size_(0),
+      pooled_array_buffer_memory_(0),
+      pooled_array_buffer_hits_(0),
+      pooled_zone_memory_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -8929,14 +8935,25 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   DCHECK_LE(heap_statistics->used_heap_size_,
             heap_statistics->total_heap_size_);
 
+  heap_statistics->used_shared_heap_size_ = heap->SharedHeapSizeOfObjects();
+  heap_statistics->total_shared_heap_size_ = heap->SharedHeapCommittedMemory();
+
+  if (auto pool = i_isolate->array_buffer_pool()) {
+    heap_statistics->pooled_array_buffer_memory_ = pool->pooled_bytes();
+    heap_statistics->pooled_array_buffer_hits_ = pool->pool_hits();
+  }
+
   heap_statistics->total_heap_size_executable_ =
       heap->CommittedMemoryExecutable();
   heap_statistics->heap_size_limit_ = heap->MaxReserved();
   // TODO(7424): There is no public API for the {WasmEngine} yet. Once such an
   // API becomes available we should report the malloced memory separately. For
   // now we just add the values, thereby over-approximating the peak slightly.
+  heap_statistics->pooled_zone_memory_ =
+      i_isolate->allocator()->GetPooledMemory();
   heap_statistics->malloced_memory_ =
       i_isolate->allocator()->GetCurrentMemoryUsage() +
+      i_isolate->allocator()->GetPooledMemory() +
       i_isolate->string_table()->GetCurrentMemoryUsage();
   // On 32-bit systems backing_store_bytes() might overflow size_t temporarily
   // due to concurrent array buffer sweeping.
@@ -8953,7 +8970,10 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
-      i::wasm::GetWasmEngine()->allocator()->GetCurrentMemoryUsage();
+      i::wasm::GetWasmEngine()->allocator()->GetCurrentMemoryUsage() +
+      i::wasm::GetWasmEngine()->allocator()->GetPooledMemory();
+  heap_statistics->pooled_zone_memory_ +=
+      i::wasm::GetWasmEngine()->allocator()->GetPooledMemory();
   heap_statistics->peak_malloced_memory_ +=
       i::wasm::GetWasmEngine()->allocator()->GetMaxMemoryUsage();
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -9009,7 +9029,10 @@ size_t Isolate::NumberOfTrackedHeapObjectTypes() {
 bool Isolate::GetHeapObjectStatisticsAtLastGC(
     HeapObjectStatistics* object_statistics, size_t type_index) {
   if (!object_statistics) return false;
-  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled())) return false;
+  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled() &&
+                 i::FLAG_gc_object_stats_sampling_interval <= 0)) {
+    return false;
+  }
 
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = i_isolate->heap();
@@ -9323,6 +9346,17 @@ void Isolate::UpdateLoadStartTime() {
   i_isolate->UpdateLoadStartTime();
 }
 
+void Isolate::SetGCPauseBudget(double max_pause_in_ms,
+                               double target_utilization) {
+  Utils::ApiCheck(max_pause_in_ms >= 0, "v8::Isolate::SetGCPauseBudget",
+                  "max_pause_in_ms must be non-negative");
+  Utils::ApiCheck(target_utilization >= 0 && target_utilization < 1,
+                  "v8::Isolate::SetGCPauseBudget",
+                  "target_utilization must be in [0, 1)");
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetGCPauseBudget(max_pause_in_ms, target_utilization);
+}
+
 void Isolate::IncreaseHeapLimitForDebugging() {
   // No-op.
 }
@@ -9934,6 +9968,21 @@ int CpuProfile::GetSamplesCount() const {
   return reinterpret_cast<const i::CpuProfile*>(this)->samples_count();
 }
 
+void CpuProfile::Serialize(OutputStream* stream,
+                           CpuProfile::SerializationFormat format) const {
+  Utils::ApiCheck(format == kPprof, "v8::CpuProfile::Serialize",
+                  "Unknown serialization format");
+  Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::CpuProfile::Serialize",
+                  "Invalid stream chunk size");
+  i::CpuProfilePprofSerializer serializer(
+      reinterpret_cast<const i::CpuProfile*>(this));
+  serializer.Serialize(stream);
+}
+
+unsigned CpuProfile::GetDroppedSamplesCount() const {
+  return reinterpret_cast<const i::CpuProfile*>(this)->dropped_samples_count();
+}
+
 CpuProfiler* CpuProfiler::New(Isolate* v8_isolate,
                               CpuProfilingNamingMode naming_mode,
                               CpuProfilingLoggingMode logging_mode) {
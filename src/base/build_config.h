@@ -60,6 +60,15 @@
 #error "Host architecture was not detected as supported by v8"
 #endif
 
+// Whether the host compiler targets SSE2, so that the intrinsics from
+// <emmintrin.h> can be used without a runtime CPU feature check.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define V8_HOST_HAS_SSE2 1
+#else
+#define V8_HOST_HAS_SSE2 0
+#endif
+
 #if defined(__ARM_ARCH_7A__) || defined(__ARM_ARCH_7R__) || \
     defined(__ARM_ARCH_7__)
 #define CAN_USE_ARMV7_INSTRUCTIONS 1
@@ -211,6 +211,10 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Hints the OS to back the given (page-aligned) region with transparent huge
+  // pages. Returns false if the platform does not support this.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -18,6 +18,12 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <stdio.h>
+#include <string.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -110,6 +116,50 @@ int64_t SysInfo::AmountOfPhysicalMemory() {
 #endif
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Reads a cgroup memory limit from |path|. Returns 0 if the file does not
+// exist or does not contain a limit (e.g. "max" for cgroup v2).
+int64_t ReadCgroupMemoryLimit(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return 0;
+  char buffer[32] = {0};
+  bool success = fgets(buffer, sizeof(buffer), file) != nullptr;
+  fclose(file);
+  if (!success || strncmp(buffer, "max", 3) == 0) return 0;
+  unsigned long long limit = 0;  // NOLINT(runtime/int)
+  if (sscanf(buffer, "%llu", &limit) != 1) return 0;
+  if (limit > static_cast<unsigned long long>(  // NOLINT(runtime/int)
+                  std::numeric_limits<int64_t>::max())) {
+    return 0;
+  }
+  return static_cast<int64_t>(limit);
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+int64_t SysInfo::AmountOfPhysicalMemoryAvailableToProcess() {
+  int64_t physical_memory = AmountOfPhysicalMemory();
+#if V8_OS_LINUX
+  static const char* const kCgroupMemoryLimitPaths[] = {
+      // cgroup v2 (unified hierarchy).
+      "/sys/fs/cgroup/memory.max",
+      // cgroup v1. Unlimited groups report a huge value here, which the
+      // comparison with the physical memory below filters out.
+      "/sys/fs/cgroup/memory/memory.limit_in_bytes",
+  };
+  for (const char* path : kCgroupMemoryLimitPaths) {
+    int64_t limit = ReadCgroupMemoryLimit(path);
+    if (limit > 0 && (physical_memory == 0 || limit < physical_memory)) {
+      return limit;
+    }
+  }
+#endif  // V8_OS_LINUX
+  return physical_memory;
+}
 
 // static
 int64_t SysInfo::AmountOfVirtualMemory() {
@@ -21,6 +21,12 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
+  // Returns the number of bytes of physical memory this process may use. On
+  // Linux this honours cgroup v1 and v2 memory limits, so that containerized
+  // processes size their heaps after the container rather than the host.
+  // Elsewhere, or without a limit, this is AmountOfPhysicalMemory().
+  static int64_t AmountOfPhysicalMemoryAvailableToProcess();
+
   // Returns the number of bytes of virtual memory of this process. A return
   // value of zero means that there is no limit on the available virtual memory.
   static int64_t AmountOfVirtualMemory();
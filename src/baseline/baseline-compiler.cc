@@ -1569,12 +1569,51 @@ void BaselineCompiler::VisitTestUndefined() {
                         });
 }
 
-void BaselineCompiler::VisitTestTypeOf() {
-  BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+namespace {
+
+RootIndex TypeofStringRootFor(interpreter::TestTypeOfFlags::LiteralFlag flag) {
+  switch (flag) {
+#define CASE(Name, name)                                  \
+  case interpreter::TestTypeOfFlags::LiteralFlag::k##Name: \
+    return RootIndex::k##name##_string;
+    TYPEOF_LITERAL_LIST(CASE)
+#undef CASE
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
 
+void BaselineCompiler::VisitTestTypeOfViaBuiltin(
+    interpreter::TestTypeOfFlags::LiteralFlag literal_flag) {
+  if (literal_flag == interpreter::TestTypeOfFlags::LiteralFlag::kOther) {
+    __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kFalseValue);
+    return;
+  }
+  // The Typeof builtin always returns one of the internalized typeof strings,
+  // so comparing against the root is enough.
+  CallBuiltin<Builtin::kTypeof>(kInterpreterAccumulatorRegister);
+  Label is_true, done;
+  __ JumpIfRoot(kInterpreterAccumulatorRegister,
+                TypeofStringRootFor(literal_flag), &is_true, Label::kNear);
+  __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kFalseValue);
+  __ Jump(&done, Label::kNear);
+  __ Bind(&is_true);
+  __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kTrueValue);
+  __ Bind(&done);
+}
+
+void BaselineCompiler::VisitTestTypeOf() {
   auto literal_flag =
       static_cast<interpreter::TestTypeOfFlags::LiteralFlag>(Flag(0));
 
+  if (FLAG_sparkplug_compact_code) {
+    VisitTestTypeOfViaBuiltin(literal_flag);
+    return;
+  }
+
+  BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+
   Label done;
   switch (literal_flag) {
     case interpreter::TestTypeOfFlags::LiteralFlag::kNumber: {
@@ -17,6 +17,7 @@
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
 #include "src/interpreter/bytecode-array-iterator.h"
+#include "src/interpreter/bytecode-flags.h"
 #include "src/interpreter/bytecode-register.h"
 #include "src/interpreter/interpreter-intrinsics.h"
 #include "src/logging/counters.h"
@@ -105,6 +106,10 @@ class BaselineCompiler {
   void UpdateInterruptBudgetAndDoInterpreterJumpIfRoot(RootIndex root);
   void UpdateInterruptBudgetAndDoInterpreterJumpIfNotRoot(RootIndex root);
 
+  // Compact lowering of TestTypeOf used by --sparkplug-compact-code.
+  void VisitTestTypeOfViaBuiltin(
+      interpreter::TestTypeOfFlags::LiteralFlag literal_flag);
+
   // Feedback vector.
   MemOperand FeedbackVector();
   void LoadFeedbackVector(Register output);
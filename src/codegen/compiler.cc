@@ -499,6 +499,11 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
   double ms_codegen = time_taken_to_finalize_.InMillisecondsF();
   CompilerTracer::TraceCompilationStats(
       isolate, compilation_info(), ms_creategraph, ms_optimize, ms_codegen);
+  if (ms_creategraph + ms_optimize + ms_codegen >
+          FLAG_expensive_turbofan_compile_ms &&
+      function->has_feedback_vector()) {
+    function->feedback_vector().set_expensive_turbofan_compile(true);
+  }
   if (FLAG_trace_opt_stats) {
     static double compilation_time = 0.0;
     static int compiled_functions = 0;
@@ -1942,6 +1947,7 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   flags.set_collect_source_positions(true);
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
+  flags.set_post_parallel_compile_tasks_for_eager_inner(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
 
   UnoptimizedCompileState compile_state;
@@ -3075,6 +3081,14 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         is_compiled_scope = result->is_compiled_scope(isolate);
         if (is_compiled_scope.is_compiled()) {
           consuming_code_cache_succeeded = true;
+          if (!maybe_script.is_null()) {
+            // The deserialized Script duplicates one that is still alive (see
+            // the TODO above); count these so that the cost is visible.
+            isolate->counters()->code_cache_duplicate_scripts()->Increment();
+            if (FLAG_profile_deserialization) {
+              PrintF("[Deserialized code duplicates a live script]\n");
+            }
+          }
           // Promote to per-isolate compilation cache.
           compilation_cache->PutScript(source, language_mode, result);
         }
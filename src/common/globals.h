@@ -972,6 +972,7 @@ enum class CodeFlushMode {
   kFlushBytecode,
   kFlushBaselineCode,
   kStressFlushCode,
+  kEagerFlushCode,
 };
 
 bool inline IsBaselineCodeFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
@@ -986,6 +987,10 @@ bool inline IsStressFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.contains(CodeFlushMode::kStressFlushCode);
 }
 
+bool inline IsEagerFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
+  return mode.contains(CodeFlushMode::kEagerFlushCode);
+}
+
 bool inline IsFlushingDisabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.empty();
 }
@@ -10,6 +10,7 @@
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/v8.h"
@@ -179,13 +180,41 @@ void OptimizingCompileDispatcher::Stop() {
 }
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
+  InstallOptimizedFunctionsUntil(base::TimeTicks());
+}
+
+void OptimizingCompileDispatcher::InstallOptimizedFunctionsWithBudget() {
+  if (FLAG_concurrent_recompilation_install_budget_us <= 0) {
+    InstallOptimizedFunctions();
+    return;
+  }
+  InstallOptimizedFunctionsUntil(
+      base::TimeTicks::Now() +
+      base::TimeDelta::FromMicroseconds(
+          FLAG_concurrent_recompilation_install_budget_us));
+}
+
+void OptimizingCompileDispatcher::InstallOptimizedFunctionsUntil(
+    base::TimeTicks deadline) {
   HandleScope handle_scope(isolate_);
+  // Keep code pages writable for the whole batch, so that installing several
+  // jobs doesn't flip page permissions once per job.
+  CodePageCollectionMemoryModificationScope code_allocation(isolate_->heap());
 
-  for (;;) {
+  for (bool first = true;; first = false) {
     std::unique_ptr<TurbofanCompilationJob> job;
     {
       base::MutexGuard access_output_queue_(&output_queue_mutex_);
       if (output_queue_.empty()) return;
+      if (!first && !deadline.IsNull() && base::TimeTicks::Now() >= deadline) {
+        // Out of budget; pick up the remaining jobs on the next interrupt.
+        if (FLAG_trace_concurrent_recompilation) {
+          PrintF("  ** Deferring installation of %zu optimized functions.\n",
+                 output_queue_.size());
+        }
+        isolate_->stack_guard()->RequestInstallCode();
+        return;
+      }
       job.reset(output_queue_.front());
       output_queue_.pop();
     }
@@ -11,6 +11,7 @@
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
@@ -43,6 +44,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void QueueForOptimization(TurbofanCompilationJob* job);
   void AwaitCompileTasks();
   void InstallOptimizedFunctions();
+  // Like InstallOptimizedFunctions, but stops once
+  // --concurrent-recompilation-install-budget-us is used up and requests
+  // another install interrupt for the jobs that are left. At least one job is
+  // finalized per call.
+  void InstallOptimizedFunctionsWithBudget();
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
@@ -72,6 +78,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
                    bool restore_function_code);
   void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
+  // Finalizes queued jobs until the output queue is empty or, if {deadline}
+  // is not null, until {deadline} has passed.
+  void InstallOptimizedFunctionsUntil(base::TimeTicks deadline);
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
 
@@ -5321,6 +5321,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
     case CTypeInfo::Type::kUint32:
       fast_call_result = ChangeUint32ToTagged(c_call_result);
       break;
+    case CTypeInfo::Type::kUint8:
     case CTypeInfo::Type::kInt64:
     case CTypeInfo::Type::kUint64:
       UNREACHABLE();
@@ -89,6 +89,8 @@ class JSCallReducerAssembler : public JSGraphAssembler {
   TNode<Boolean> ReduceStringPrototypeStartsWith();
   TNode<Boolean> ReduceStringPrototypeStartsWith(
       const StringRef& search_element_string);
+  TNode<Boolean> ReduceStringPrototypeEndsWith(
+      const StringRef& search_element_string);
   TNode<String> ReduceStringPrototypeSlice();
 
   TNode<Object> TargetInput() const { return JSCallNode{node_ptr()}.target(); }
@@ -1282,6 +1284,55 @@ TNode<Boolean> JSCallReducerAssembler::ReduceStringPrototypeStartsWith() {
   return out.PhiAt<Boolean>(0);
 }
 
+TNode<Boolean> JSCallReducerAssembler::ReduceStringPrototypeEndsWith(
+    const StringRef& search_element_string) {
+  TNode<Object> receiver = ReceiverInput();
+  TNode<Object> end_position = ArgumentOrUndefined(1);
+
+  TNode<String> receiver_string = CheckString(receiver);
+  TNode<Number> length = StringLength(receiver_string);
+
+  TNode<Number> zero = ZeroConstant();
+  TNode<Number> clamped_end =
+      SelectIf<Number>(IsUndefined(end_position))
+          .Then(_ { return length; })
+          .Else(_ {
+            return NumberMin(NumberMax(CheckSmi(end_position), zero), length);
+          })
+          .ExpectTrue()
+          .Value();
+
+  int search_string_length = search_element_string.length().value();
+  DCHECK(search_string_length <= JSCallReducer::kMaxInlineMatchSequence);
+
+  auto out = MakeLabel(MachineRepresentation::kTagged);
+
+  TNode<Number> start =
+      NumberSubtract(clamped_end, NumberConstant(search_string_length));
+  GotoIf(NumberLessThan(start, zero), &out, BranchHint::kFalse,
+         FalseConstant());
+
+  static_assert(String::kMaxLength <= kSmiMaxValue);
+
+  for (int i = 0; i < search_string_length; i++) {
+    TNode<Number> k = NumberConstant(i);
+    TNode<Number> receiver_string_position = TNode<Number>::UncheckedCast(
+        TypeGuard(Type::UnsignedSmall(), NumberAdd(k, start)));
+    Node* receiver_string_char =
+        StringCharCodeAt(receiver_string, receiver_string_position);
+    Node* search_string_char =
+        jsgraph()->Constant(search_element_string.GetChar(i).value());
+    auto is_equal = graph()->NewNode(simplified()->NumberEqual(),
+                                     search_string_char, receiver_string_char);
+    GotoIfNot(is_equal, &out, FalseConstant());
+  }
+
+  Goto(&out, TrueConstant());
+
+  Bind(&out);
+  return out.PhiAt<Boolean>(0);
+}
+
 TNode<String> JSCallReducerAssembler::ReduceStringPrototypeSlice() {
   TNode<Object> receiver = ReceiverInput();
   TNode<Object> start = Argument(0);
@@ -4812,6 +4863,10 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceStringPrototypeSubstr(node);
     case Builtin::kStringPrototypeStartsWith:
       return ReduceStringPrototypeStartsWith(node);
+    case Builtin::kStringPrototypeEndsWith:
+      return ReduceStringPrototypeEndsWith(node);
+    case Builtin::kStringPrototypeSplit:
+      return ReduceStringPrototypeSplit(node);
 #ifdef V8_INTL_SUPPORT
     case Builtin::kStringPrototypeToLowerCaseIntl:
       return ReduceStringPrototypeToLowerCaseIntl(node);
@@ -6549,6 +6604,96 @@ Reduction JSCallReducer::ReduceStringPrototypeStartsWith(Node* node) {
   return ReplaceWithSubgraph(&a, subgraph);
 }
 
+// ES #sec-string.prototype.endswith
+Reduction JSCallReducer::ReduceStringPrototypeEndsWith(Node* node) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  // Only inline the matching sequence for short constant search strings; the
+  // generic case is left to the builtin.
+  TNode<Object> search_element = n.ArgumentOrUndefined(0, jsgraph());
+  HeapObjectMatcher search_element_matcher(search_element);
+  if (!search_element_matcher.HasResolvedValue()) return NoChange();
+  ObjectRef target_ref = search_element_matcher.Ref(broker());
+  if (!target_ref.IsString()) return NoChange();
+  StringRef search_element_string = target_ref.AsString();
+  if (!search_element_string.length().has_value()) return NoChange();
+  if (search_element_string.length().value() > kMaxInlineMatchSequence) {
+    return NoChange();
+  }
+
+  JSCallReducerAssembler a(this, node);
+  Node* subgraph = a.ReduceStringPrototypeEndsWith(search_element_string);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
+// ES #sec-string.prototype.split
+// String.prototype.split ( separator, limit )
+Reduction JSCallReducer::ReduceStringPrototypeSplit(Node* node) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  // Only handle a constant one-character {separator} without a {limit}; the
+  // runtime caches the result for this case, so the builtin's generic
+  // @@split lookup is the only thing worth skipping.
+  if (n.ArgumentCount() < 1) return NoChange();
+  if (n.ArgumentCount() > 1) {
+    HeapObjectMatcher limit_matcher(n.Argument(1));
+    if (!limit_matcher.Is(factory()->undefined_value())) return NoChange();
+  }
+  Node* separator = n.Argument(0);
+  HeapObjectMatcher separator_matcher(separator);
+  if (!separator_matcher.HasResolvedValue()) return NoChange();
+  ObjectRef separator_ref = separator_matcher.Ref(broker());
+  if (!separator_ref.IsString()) return NoChange();
+  StringRef separator_string = separator_ref.AsString();
+  if (!separator_string.length().has_value()) return NoChange();
+  if (separator_string.length().value() != 1) return NoChange();
+
+  // Make sure that String.prototype.split doesn't end up calling a
+  // user-defined @@split method for the {separator}.
+  PropertyAccessInfo access_info = broker()->GetPropertyAccessInfo(
+      separator_string.map(), MakeRef(broker(), factory()->split_symbol()),
+      AccessMode::kLoad, dependencies());
+  if (access_info.IsInvalid() || access_info.HasDictionaryHolder()) {
+    return NoChange();
+  }
+  if (!access_info.IsNotFound()) return NoChange();
+  dependencies()->DependOnStablePrototypeChains(
+      access_info.lookup_start_object_maps(), kStartAtPrototype);
+
+  Node* context = n.context();
+  FrameState frame_state = n.frame_state();
+  Effect effect = n.effect();
+  Control control = n.control();
+
+  // Ensure that the {receiver} is actually a String.
+  Node* receiver = effect = graph()->NewNode(
+      simplified()->CheckString(p.feedback()), n.receiver(), effect, control);
+
+  Node* value = effect = control = graph()->NewNode(
+      javascript()->CallRuntime(Runtime::kStringSplit, 3), receiver, separator,
+      jsgraph()->Constant(kMaxUInt32), context, frame_state, effect, control);
+
+  // Rewire potential exception edges.
+  Node* on_exception = nullptr;
+  if (NodeProperties::IsExceptionalCall(node, &on_exception)) {
+    Node* if_exception =
+        graph()->NewNode(common()->IfException(), effect, control);
+    control = graph()->NewNode(common()->IfSuccess(), control);
+    ReplaceWithValue(on_exception, if_exception, if_exception, if_exception);
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 // ES section 21.1.3.1 String.prototype.charAt ( pos )
 Reduction JSCallReducer::ReduceStringPrototypeCharAt(Node* node) {
   JSCallNode n(node);
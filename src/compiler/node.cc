@@ -8,9 +8,14 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+// With zone compression, inputs and use links are 32-bit offsets into the
+// graph zone instead of full pointers.
+static_assert(sizeof(ZoneNodePtr) ==
+              (kCompressGraphZone ? kUInt32Size : kSystemPointerSize));
+
 Node::OutOfLineInputs* Node::OutOfLineInputs::New(Zone* zone, int capacity) {
   size_t size =
-      sizeof(OutOfLineInputs) + capacity * (sizeof(Node*) + sizeof(Use));
+      sizeof(OutOfLineInputs) + capacity * (sizeof(ZoneNodePtr) + sizeof(Use));
   intptr_t raw_buffer =
       reinterpret_cast<intptr_t>(zone->Allocate<Node::OutOfLineInputs>(size));
   Node::OutOfLineInputs* outline =
@@ -3544,20 +3544,19 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   bool run_verifier = FLAG_turbo_verify_allocation;
 
   // Allocate registers.
-
-  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
-  // WebAssembly programs, and chosing the limit such that functions that take
-  // >100ms in register allocation are switched to mid-tier.
-  static int kTopTierVirtualRegistersLimit = 8192;
-
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
+  const bool is_huge_function =
+      data->sequence()->VirtualRegisterCount() >
+          FLAG_turbo_mid_tier_regalloc_virtual_registers_limit ||
+      (FLAG_turbo_mid_tier_regalloc_blocks_limit > 0 &&
+       data->sequence()->InstructionBlockCount() >
+           FLAG_turbo_mid_tier_regalloc_blocks_limit);
   bool use_mid_tier_register_allocator =
       !CodeKindIsStaticallyCompiled(data->info()->code_kind()) &&
       (FLAG_turbo_force_mid_tier_regalloc ||
        (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
-        data->sequence()->VirtualRegisterCount() >
-            kTopTierVirtualRegistersLimit));
+        is_huge_function));
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
@@ -1895,6 +1895,7 @@ class RepresentationSelector {
       case CTypeInfo::SequenceType::kScalar: {
         switch (type.GetType()) {
           case CTypeInfo::Type::kVoid:
+          case CTypeInfo::Type::kUint8:
             UNREACHABLE();
           case CTypeInfo::Type::kBool:
             return UseInfo::Bool();
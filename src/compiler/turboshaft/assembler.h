@@ -19,6 +19,7 @@
 #include "src/codegen/machine-type.h"
 #include "src/compiler/turboshaft/graph.h"
 #include "src/compiler/turboshaft/operations.h"
+#include "src/flags/flags.h"
 #include "src/zone/zone-containers.h"
 
 namespace v8::internal::compiler::turboshaft {
@@ -137,6 +138,9 @@ class Assembler
     if (!graph().Add(block)) return false;
     DCHECK_NULL(current_block_);
     current_block_ = block;
+    // Value numbering is block-local, so earlier entries need not dominate
+    // the new block.
+    value_numbers_.clear();
     return true;
   }
 
@@ -173,7 +177,7 @@ class Assembler
   }
 
   explicit Assembler(Graph* graph, Zone* phase_zone)
-      : graph_(*graph), phase_zone_(phase_zone) {
+      : graph_(*graph), phase_zone_(phase_zone), value_numbers_(phase_zone) {
     graph_.Reset();
   }
 
@@ -195,13 +199,40 @@ class Assembler
     static_assert(!(std::is_same<Op, Operation>::value));
     DCHECK_NOT_NULL(current_block_);
     OpIndex result = graph().Add<Op>(args...);
+    if constexpr (CanBeValueNumbered<Op>()) {
+      if (FLAG_turboshaft_value_numbering) result = ValueNumber<Op>(result);
+    }
     if (Op::properties.is_block_terminator) FinalizeBlock();
     return result;
   }
 
+  template <class Op>
+  static constexpr bool CanBeValueNumbered() {
+    // Pending loop phis are placeholders that are replaced once the backedge
+    // is known, so they cannot be compared yet.
+    return Op::properties.is_pure && !std::is_same<Op, PendingLoopPhiOp>::value;
+  }
+
+  // If an equal operation was already emitted in the current block, drops the
+  // operation just added at {index} and returns the earlier one instead.
+  template <class Op>
+  OpIndex ValueNumber(OpIndex index) {
+    const Op& op = graph().Get(index).Cast<Op>();
+    auto [it, inserted] = value_numbers_.insert({op.hash_value(), index});
+    if (inserted) return index;
+    const Operation& candidate = graph().Get(it->second);
+    // On a hash collision with a different operation, keep the new one. This
+    // only loses an opportunity, never correctness.
+    if (!candidate.Is<Op>() || !(candidate.Cast<Op>() == op)) return index;
+    graph().RemoveLast();
+    return it->second;
+  }
+
   Block* current_block_ = nullptr;
   Graph& graph_;
   Zone* const phase_zone_;
+  // Pure operations emitted in the current block, keyed by their hash.
+  ZoneUnorderedMap<size_t, OpIndex> value_numbers_;
 };
 
 }  // namespace v8::internal::compiler::turboshaft
@@ -904,10 +904,12 @@ struct ConstantOp : FixedArityOperationT<0, ConstantOp> {
       case Kind::kTaggedIndex:
         return base::hash_combine(kind, storage.integral);
       case Kind::kFloat32:
-        return base::hash_combine(kind, storage.float32);
+        return base::hash_combine(kind,
+                                  base::bit_cast<uint32_t>(storage.float32));
       case Kind::kFloat64:
       case Kind::kNumber:
-        return base::hash_combine(kind, storage.float64);
+        return base::hash_combine(kind,
+                                  base::bit_cast<uint64_t>(storage.float64));
       case Kind::kExternal:
         return base::hash_combine(kind, storage.external.address());
       case Kind::kHeapObject:
@@ -924,11 +926,15 @@ struct ConstantOp : FixedArityOperationT<0, ConstantOp> {
       case Kind::kWord64:
       case Kind::kTaggedIndex:
         return storage.integral == other.storage.integral;
+      // Compare floats bitwise, so that 0.0 and -0.0 are not considered equal
+      // while NaNs with the same bit pattern are.
       case Kind::kFloat32:
-        return storage.float32 == other.storage.float32;
+        return base::bit_cast<uint32_t>(storage.float32) ==
+               base::bit_cast<uint32_t>(other.storage.float32);
       case Kind::kFloat64:
       case Kind::kNumber:
-        return storage.float64 == other.storage.float64;
+        return base::bit_cast<uint64_t>(storage.float64) ==
+               base::bit_cast<uint64_t>(other.storage.float64);
       case Kind::kExternal:
         return storage.external.address() == other.storage.external.address();
       case Kind::kHeapObject:
@@ -47,9 +47,9 @@ struct ScheduleBuilder {
   compiler::BasicBlock* current_block = schedule->start();
   const Block* current_input_block = nullptr;
   ZoneUnorderedMap<int, Node*> parameters{phase_zone};
-  std::vector<BasicBlock*> blocks = {};
-  std::vector<Node*> nodes{input_graph.op_id_count()};
-  std::vector<std::pair<Node*, OpIndex>> loop_phis = {};
+  ZoneVector<BasicBlock*> blocks{phase_zone};
+  ZoneVector<Node*> nodes{input_graph.op_id_count(), phase_zone};
+  ZoneVector<std::pair<Node*, OpIndex>> loop_phis{phase_zone};
 
   RecreateScheduleResult Run();
   Node* MakeNode(const Operator* op, base::Vector<Node* const> inputs);
@@ -5111,8 +5111,52 @@ void WasmGraphBuilder::MemTypeToUintPtrOrOOBTrap(
   TrapIfTrue(wasm::kTrapMemOutOfBounds, any_high_word, position);
 }
 
+namespace {
+// memory.copy and memory.fill with a small constant size are lowered to a
+// single bounds-checked load and/or store instead of a call to C. Returns
+// MachineType::None() if {size} does not qualify.
+MachineType SmallBulkMemoryAccessType(Node* size, bool is_memory64) {
+  // Keep --trace-wasm-memory output identical to the out-of-line path.
+  if (FLAG_trace_wasm_memory) return MachineType::None();
+  uint64_t constant_size;
+  if (is_memory64) {
+    Uint64Matcher m(size);
+    if (!m.HasResolvedValue()) return MachineType::None();
+    constant_size = m.ResolvedValue();
+  } else {
+    Uint32Matcher m(size);
+    if (!m.HasResolvedValue()) return MachineType::None();
+    constant_size = m.ResolvedValue();
+  }
+  switch (constant_size) {
+    case 1:
+      return MachineType::Uint8();
+    case 2:
+      return MachineType::Uint16();
+    case 4:
+      return MachineType::Uint32();
+    case 8:
+      return MachineType::Uint64();
+    default:
+      return MachineType::None();
+  }
+}
+}  // namespace
+
 void WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
                                   wasm::WasmCodePosition position) {
+  MachineType small_type =
+      SmallBulkMemoryAccessType(size, env_->module->is_memory64);
+  if (small_type != MachineType::None()) {
+    // The load traps before anything is written if {src} is out of bounds,
+    // and loading the whole range first makes overlapping ranges safe.
+    wasm::ValueType type =
+        small_type == MachineType::Uint64() ? wasm::kWasmI64 : wasm::kWasmI32;
+    Node* value = LoadMem(type, small_type, src, 0, 0, position);
+    StoreMem(small_type.representation(), dst, 0, 0, value, position, type);
+    return;
+  }
+
   Node* function =
       gasm_->ExternalConstant(ExternalReference::wasm_memory_copy());
 
@@ -5132,6 +5176,30 @@ void WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
 
 void WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
                                   wasm::WasmCodePosition position) {
+  MachineType small_type =
+      SmallBulkMemoryAccessType(size, env_->module->is_memory64);
+  if (small_type != MachineType::None()) {
+    // Replicate the fill byte over the access width.
+    Node* byte = gasm_->Word32And(value, Int32Constant(0xFF));
+    wasm::ValueType type = wasm::kWasmI32;
+    Node* pattern;
+    if (small_type == MachineType::Uint8()) {
+      pattern = byte;
+    } else if (small_type == MachineType::Uint16()) {
+      pattern = gasm_->Int32Mul(byte, Int32Constant(0x0101));
+    } else if (small_type == MachineType::Uint32()) {
+      pattern = gasm_->Int32Mul(byte, Int32Constant(0x01010101));
+    } else {
+      DCHECK_EQ(small_type, MachineType::Uint64());
+      type = wasm::kWasmI64;
+      Node* low = gasm_->ChangeUint32ToUint64(
+          gasm_->Int32Mul(byte, Int32Constant(0x01010101)));
+      pattern = gasm_->Word64Or(low, gasm_->Word64Shl(low, Int32Constant(32)));
+    }
+    StoreMem(small_type.representation(), dst, 0, 0, pattern, position, type);
+    return;
+  }
+
   Node* function =
       gasm_->ExternalConstant(ExternalReference::wasm_memory_fill());
 
@@ -3985,6 +3985,7 @@ bool ends_with(const char* input, const char* suffix) {
 
 bool SourceGroup::Execute(Isolate* isolate) {
   bool success = true;
+  base::TimeTicks start = base::TimeTicks::Now();
 #ifdef V8_FUZZILLI
   if (fuzzilli_reprl) {
     HandleScope handle_scope(isolate);
@@ -4091,6 +4092,9 @@ bool SourceGroup::Execute(Isolate* isolate) {
       break;
     }
   }
+  if (Shell::options.isolate_stats) {
+    ReportIsolateStats(isolate, base::TimeTicks::Now() - start);
+  }
   if (!success) {
     return false;
   }
@@ -4101,6 +4105,25 @@ bool SourceGroup::Execute(Isolate* isolate) {
   return success;
 }
 
+void SourceGroup::ReportIsolateStats(Isolate* isolate,
+                                     base::TimeDelta elapsed) const {
+  HeapStatistics heap_stats;
+  isolate->GetHeapStatistics(&heap_stats);
+  HeapCodeStatistics code_stats;
+  isolate->GetHeapCodeAndMetadataStatistics(&code_stats);
+  const SourceGroup* first = Shell::options.isolate_sources;
+  // Print everything with a single call, so that lines from isolates running
+  // concurrently don't interleave.
+  printf(
+      "isolate %d: %.3f ms, heap used %zu KB, heap total %zu KB, "
+      "code %zu KB, bytecode %zu KB\n",
+      static_cast<int>(this - first), elapsed.InMillisecondsF(),
+      heap_stats.used_heap_size() / i::KB, heap_stats.total_heap_size() / i::KB,
+      code_stats.code_and_metadata_size() / i::KB,
+      code_stats.bytecode_and_metadata_size() / i::KB);
+  fflush(stdout);
+}
+
 SourceGroup::IsolateThread::IsolateThread(SourceGroup* group)
     : base::Thread(GetThreadOptions("IsolateThread")), group_(group) {}
 
@@ -4559,6 +4582,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       argv[i] = nullptr;
     } else if (strcmp(argv[i], "--isolate") == 0) {
       options.num_isolates++;
+    } else if (strcmp(argv[i], "--isolate-stats") == 0) {
+      options.isolate_stats = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = nullptr;
@@ -5481,7 +5507,7 @@ int Shell::Main(int argc, char* argv[]) {
   create_params.code_event_handler = vTune::GetVtuneCodeEventHandler();
 #endif
   create_params.constraints.ConfigureDefaults(
-      base::SysInfo::AmountOfPhysicalMemory(),
+      base::SysInfo::AmountOfPhysicalMemoryAvailableToProcess(),
       base::SysInfo::AmountOfVirtualMemory());
 
   Shell::counter_map_ = new CounterMap();
@@ -5504,7 +5530,7 @@ int Shell::Main(int argc, char* argv[]) {
   if (HasFlagThatRequiresSharedIsolate()) {
     Isolate::CreateParams shared_create_params;
     shared_create_params.constraints.ConfigureDefaults(
-        base::SysInfo::AmountOfPhysicalMemory(),
+        base::SysInfo::AmountOfPhysicalMemoryAvailableToProcess(),
         base::SysInfo::AmountOfVirtualMemory());
     shared_create_params.array_buffer_allocator = Shell::array_buffer_allocator;
     shared_isolate =
@@ -122,6 +122,7 @@ class SourceGroup {
   };
 
   void ExecuteInThread();
+  void ReportIsolateStats(Isolate* isolate, base::TimeDelta elapsed) const;
 
   base::Semaphore next_semaphore_;
   base::Semaphore done_semaphore_;
@@ -432,6 +433,7 @@ class ShellOptions {
 #endif
   DisallowReassignment<bool> enable_inspector = {"enable-inspector", false};
   int num_isolates = 1;
+  DisallowReassignment<bool> isolate_stats = {"isolate-stats", false};
   DisallowReassignment<v8::ScriptCompiler::CompileOptions, true>
       compile_options = {"cache", v8::ScriptCompiler::kNoCompileOptions};
   DisallowReassignment<CodeCacheOptions, true> code_cache_options = {
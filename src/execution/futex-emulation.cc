@@ -5,6 +5,7 @@
 #include "src/execution/futex-emulation.h"
 
 #include <limits>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -91,8 +92,9 @@ class FutexWaitList {
     FutexWaitListNode* tail;
   };
   // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  // location. Hashed, since Wait and Notify look up a single location while
+  // holding the global mutex and the number of locations can be large.
+  std::unordered_map<int8_t*, HeadAndTail> location_lists_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -3978,6 +3979,12 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   metrics_recorder_ = std::make_shared<metrics::Recorder>();
 
+  if (FLAG_array_buffer_pool_size > 0) {
+    array_buffer_pool_ = std::make_shared<PoolingArrayBufferAllocator>(
+        array_buffer_allocator_, array_buffer_allocator_shared_,
+        static_cast<size_t>(FLAG_array_buffer_pool_size) * KB);
+  }
+
   {
     // Ensure that the thread has a valid stack guard.  The v8::Locker object
     // will ensure this too, but we don't have to use lockers if we are only
@@ -5413,21 +5420,34 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  ICUObjectCacheEntry* entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (int i = 0; i < kICUObjectCacheEntriesPerType; i++) {
+    if (!entries[i].obj) break;
+    if (!StringEqualsLocales(this, entries[i].locales, locales)) continue;
+    // Move the hit to the front so that the last entry is the LRU one.
+    std::rotate(entries, entries + i, entries + i + 1);
+    return entries[0].obj.get();
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  ICUObjectCacheEntry* entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  // Evict the least recently used entry and insert the new one at the front.
+  std::rotate(entries, entries + kICUObjectCacheEntriesPerType - 1,
+              entries + kICUObjectCacheEntriesPerType);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
@@ -126,6 +126,7 @@ class MicrotaskQueue;
 class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
+class PoolingArrayBufferAllocator;
 class ReadOnlyArtifacts;
 class RegExpStack;
 class RootVisitor;
@@ -1766,6 +1767,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return array_buffer_allocator_shared_;
   }
 
+  // The pool that unshared array buffer backing stores are allocated from,
+  // or nullptr if --array-buffer-pool-size is 0.
+  std::shared_ptr<PoolingArrayBufferAllocator> array_buffer_pool() const {
+    return array_buffer_pool_;
+  }
+
   FutexWaitListNode* futex_wait_list_node() { return &futex_wait_list_node_; }
 
   CancelableTaskManager* cancelable_task_manager() {
@@ -2203,8 +2210,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the most recently accessed {locales,obj} pairs for each
+  // cache type, ordered from most to least recently used. Keeping a few
+  // entries per type avoids thrashing when callers alternate between locales.
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2214,7 +2222,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  static constexpr int kICUObjectCacheEntriesPerType = 4;
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheEntriesPerType];
 #endif  // V8_INTL_SUPPORT
 
   // true if being profiled. Causes collection of extra compile info.
@@ -2364,6 +2374,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   v8::ArrayBuffer::Allocator* array_buffer_allocator_ = nullptr;
   std::shared_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_shared_;
+  std::shared_ptr<PoolingArrayBufferAllocator> array_buffer_pool_;
 
   FutexWaitListNode futex_wait_list_node_;
 
@@ -8,6 +8,7 @@
 #include <cstddef>
 
 #include "src/api/api-inl.h"
+#include "src/base/bits.h"
 #include "src/base/logging.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
@@ -212,7 +213,14 @@ void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
                                                static_cast<intptr_t>(0))));
   }
 
-  if (capacity_ <= kMinimumCapacity) {
+  // Workloads that repeatedly enqueue bursts of microtasks would otherwise
+  // shrink the buffer on every GC and regrow it by doubling on the next burst.
+  // Keep at least |retained_capacity| slots to avoid that churn.
+  intptr_t retained_capacity = std::max(
+      kMinimumCapacity,
+      static_cast<intptr_t>(base::bits::RoundUpToPowerOfTwo(static_cast<size_t>(
+          std::max(FLAG_microtask_queue_retained_capacity, 0)))));
+  if (capacity_ <= retained_capacity) {
     return;
   }
 
@@ -220,7 +228,7 @@ void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
   while (new_capacity > 2 * size_) {
     new_capacity >>= 1;
   }
-  new_capacity = std::max(new_capacity, kMinimumCapacity);
+  new_capacity = std::max(new_capacity, retained_capacity);
   if (new_capacity < capacity_) {
     ResizeBuffer(new_capacity);
   }
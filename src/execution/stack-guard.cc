@@ -320,7 +320,8 @@ Object StackGuard::HandleInterrupts() {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.InstallOptimizedFunctions");
     DCHECK(isolate_->concurrent_recompilation_enabled());
-    isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
+    isolate_->optimizing_compile_dispatcher()
+        ->InstallOptimizedFunctionsWithBudget();
   }
 
   if (TestAndClear(&interrupt_flags, INSTALL_BASELINE_CODE)) {
@@ -142,6 +142,10 @@ void TraceManualRecompile(JSFunction function, CodeKind code_kind,
 void TieringManager::Optimize(JSFunction function, OptimizationDecision d) {
   DCHECK(d.should_optimize());
   TraceRecompile(isolate_, function, d);
+  if (V8_UNLIKELY(FLAG_code_cache_tiering_hints) &&
+      d.code_kind == CodeKind::TURBOFAN) {
+    function.shared().set_was_marked_for_turbofan(true);
+  }
   function.MarkForOptimization(isolate_, d.code_kind, d.concurrency_mode);
 }
 
@@ -293,15 +297,36 @@ OptimizationDecision TieringManager::ShouldOptimize(JSFunction function,
     return OptimizationDecision::DoNotOptimize();
   }
 
+  FeedbackVector vector = function.feedback_vector();
+  const bool expensive = vector.expensive_turbofan_compile();
+  if (expensive && code_kind == CodeKind::MAGLEV &&
+      vector.turbofan_deopt_count() >=
+          FLAG_max_deopts_for_expensive_turbofan_compile) {
+    if (FLAG_trace_opt_verbose) {
+      PrintF("[not optimizing %s: expensive to compile and deoptimized %d "
+             "times]\n",
+             function.DebugNameCStr().get(), vector.turbofan_deopt_count());
+    }
+    return OptimizationDecision::DoNotOptimize();
+  }
+
   BytecodeArray bytecode = function.shared().GetBytecodeArray(isolate_);
-  const int ticks = function.feedback_vector().profiler_ticks();
-  const int ticks_for_optimization =
+  const int ticks = vector.profiler_ticks();
+  // Functions that were hot in the process that produced the code cache
+  // still need a few ticks to collect feedback, but not the extra ticks
+  // that large functions normally wait for.
+  const bool hinted = V8_UNLIKELY(FLAG_code_cache_tiering_hints) &&
+                      function.shared().was_marked_for_turbofan();
+  int ticks_for_optimization =
       FLAG_ticks_before_optimization +
-      (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+      (hinted ? 0 : bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+  // Back off exponentially from re-optimizing functions that are expensive to
+  // compile each time they deoptimize.
+  if (expensive) ticks_for_optimization <<= vector.turbofan_deopt_count();
   if (ticks >= ticks_for_optimization) {
     return OptimizationDecision::TurbofanHotAndStable();
-  } else if (ShouldOptimizeAsSmallFunction(bytecode.length(),
-                                           any_ic_changed_)) {
+  } else if (!expensive && ShouldOptimizeAsSmallFunction(bytecode.length(),
+                                                         any_ic_changed_)) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
     return OptimizationDecision::TurbofanSmallFunction();
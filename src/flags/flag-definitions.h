@@ -438,6 +438,8 @@ DEFINE_NEG_IMPLICATION(enable_third_party_heap, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, script_streaming)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap,
                        parallel_compile_tasks_for_eager_toplevel)
+DEFINE_NEG_IMPLICATION(enable_third_party_heap,
+                       parallel_compile_tasks_for_eager_inner)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, use_marking_progress_bar)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, move_object_start)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, concurrent_marking)
@@ -514,6 +516,14 @@ DEFINE_BOOL(future, FUTURE_BOOL,
 DEFINE_BOOL(maglev, false, "enable the maglev optimizing compiler")
 DEFINE_BOOL(maglev_inlining, false,
             "enable inlining in the maglev optimizing compiler")
+DEFINE_INT(max_maglev_inlined_bytecode_size, 100,
+           "maximum size of bytecode for a single inlining in maglev")
+DEFINE_INT(max_maglev_inline_depth, 1, "maximum inlining depth in maglev")
+DEFINE_FLOAT(min_maglev_inlining_frequency, 0.10,
+             "minimum call frequency for a call site to be inlined in maglev")
+DEFINE_UINT(concurrent_maglev_max_threads, 2,
+            "max number of threads that concurrent Maglev can use (0 for "
+            "unbounded)")
 #else
 #define V8_ENABLE_MAGLEV_BOOL false
 DEFINE_BOOL_READONLY(maglev, false, "enable the maglev optimizing compiler")
@@ -658,6 +668,17 @@ DEFINE_INT(bytecode_size_allowance_per_tick, 1100,
 DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
+DEFINE_INT(expensive_turbofan_compile_ms, 100,
+           "Turbofan compiles taking longer than this many ms mark the "
+           "function as expensive; re-optimizing it after deopts backs off "
+           "exponentially")
+DEFINE_INT(max_deopts_for_expensive_turbofan_compile, 3,
+           "expensive functions that deoptimized out of Turbofan this many "
+           "times stay in Maglev, if Maglev is enabled")
+DEFINE_BOOL(code_cache_tiering_hints, false,
+            "remember which functions were marked for Turbofan so that the "
+            "code cache carries the hint, and skip the bytecode size "
+            "allowance for hinted functions")
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
@@ -679,6 +700,10 @@ DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
             "regenerate when actually required")
 DEFINE_BOOL(stress_lazy_source_positions, false,
             "collect lazy source positions immediately after lazy compile")
+DEFINE_BOOL(log_existing_code_source_positions, true,
+            "reparse functions to collect missing source positions when "
+            "logging existing code (e.g. on profiler start); otherwise such "
+            "functions are only attributed at function granularity")
 DEFINE_STRING(print_bytecode_filter, "*",
               "filter for selecting which functions to print bytecode")
 #ifdef V8_TRACE_UNOPTIMIZED
@@ -747,6 +772,9 @@ DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
+DEFINE_BOOL(sparkplug_compact_code, false,
+            "emit calls to shared builtins instead of inline code for large "
+            "uncommon bytecodes in Sparkplug")
 DEFINE_INT(baseline_batch_compilation_threshold, 4 * KB,
            "the estimated instruction size of a batch to trigger compilation")
 DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
@@ -781,6 +809,10 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_INT(concurrent_recompilation_install_budget_us, 0,
+           "main-thread time budget in microseconds for finalizing "
+           "concurrent optimization jobs per install interrupt; remaining "
+           "jobs are finalized on the next interrupt (0 means unlimited)")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -950,6 +982,16 @@ DEFINE_WEAK_IMPLICATION(future, turbo_inline_js_wasm_calls)
 DEFINE_BOOL(turbo_inline_js_wasm_calls, false, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
+// The default virtual register limit is chosen somewhat arbitrarily, by looking
+// at a few bigger WebAssembly programs, and chosing the limit such that
+// functions that take >100ms in register allocation are switched to mid-tier.
+DEFINE_INT(turbo_mid_tier_regalloc_virtual_registers_limit, 8192,
+           "functions with more virtual registers than this are considered "
+           "huge for --turbo-use-mid-tier-regalloc-for-huge-functions")
+DEFINE_INT(turbo_mid_tier_regalloc_blocks_limit, 0,
+           "functions with more instruction blocks than this are considered "
+           "huge for --turbo-use-mid-tier-regalloc-for-huge-functions "
+           "(0 means no limit)")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
 
@@ -967,6 +1009,9 @@ DEFINE_FLOAT(script_delay_fraction, 0.0,
              "run's duration")
 
 DEFINE_BOOL(turboshaft, false, "enable TurboFan's TurboShaft phases")
+DEFINE_BOOL(turboshaft_value_numbering, true,
+            "reuse equal pure operations within a block while building the "
+            "TurboShaft graph")
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1145,6 +1190,9 @@ DEFINE_BOOL(wasm_lazy_compilation, false,
 // Write protect code causes too much overhead for lazy compilation.
 DEFINE_WEAK_NEG_IMPLICATION(wasm_lazy_compilation,
                             wasm_write_protect_code_memory)
+DEFINE_BOOL(wasm_lazy_compile_callees, false,
+            "when a function is compiled lazily, compile its direct callees "
+            "in the background")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
@@ -1207,6 +1255,10 @@ DEFINE_BOOL(huge_max_old_generation_size, true,
             "Increase max size of the old space to 4 GB for x64 systems with"
             "the physical memory bigger than 16 GB")
 DEFINE_SIZE_T(initial_old_space_size, 0, "initial old space size (in Mbytes)")
+DEFINE_UINT(max_number_string_cache_entries, 0x4000,
+            "upper bound on the number of entries in the number-string cache "
+            "(rounded up to a power of two, at most 2^24); the cache is also "
+            "limited to max_semi_space_size / 512 entries")
 DEFINE_BOOL(separate_gc_phases, false,
             "yound and full garbage collection phases are not overlapping")
 DEFINE_BOOL(global_gc_scheduling, true,
@@ -1297,6 +1349,13 @@ DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_INT(array_buffer_pool_size, 0,
+           "maximum size in KB of freed array buffer backing stores (4-64 KB) "
+           "kept per isolate for reuse (0 disables pooling)")
+DEFINE_INT(zone_segment_pool_size, 0,
+           "maximum size in KB of freed zone segments (8-32 KB) kept per "
+           "zone allocator for reuse by later compilation jobs (0 disables "
+           "pooling)")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, V8_CONCURRENT_MARKING_BOOL,
@@ -1317,6 +1376,9 @@ DEFINE_BOOL(trace_stress_marking, false, "trace stress marking progress")
 DEFINE_BOOL(trace_stress_scavenge, false, "trace stress scavenge progress")
 DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
+DEFINE_INT(gc_object_stats_sampling_interval, 0,
+           "record object counts and memory usage on every n-th full GC, "
+           "to be reported by GetHeapObjectStatisticsAtLastGC (0 disables)")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
@@ -1365,6 +1427,9 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "back the code range and the pointer compression cage with "
+            "transparent huge pages where supported (Linux only)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1393,6 +1458,9 @@ DEFINE_BOOL(flush_baseline_code, false,
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
+DEFINE_BOOL(flush_code_on_memory_reducing_gc, false,
+            "flush bytecode that was not executed since the last full GC "
+            "during GCs that reduce the memory footprint")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
@@ -1537,6 +1605,9 @@ DEFINE_BOOL(expose_ignition_statistics, false,
             "expose ignition-statistics extension (requires building with "
             "v8_enable_ignition_dispatch_counting)")
 DEFINE_INT(stack_trace_limit, 10, "number of stack frames to capture")
+DEFINE_INT(microtask_queue_retained_capacity, 8,
+           "number of microtask ring buffer slots kept across GCs once the "
+           "queue has grown (rounded up to a power of two)")
 DEFINE_BOOL(builtins_in_stack_traces, false,
             "show built-in functions in stack traces")
 DEFINE_BOOL(experimental_stack_trace_frames, false,
@@ -1618,6 +1689,11 @@ DEFINE_BOOL(
     "spawn parallel compile tasks for eagerly compiled, top-level functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
                    lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_eager_inner, false,
+            "spawn parallel compile tasks for eagerly compiled inner functions "
+            "(e.g. IIFEs nested in a bundle's top-level closure)")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_inner,
+                   lazy_compile_dispatcher)
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
@@ -1813,6 +1889,10 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "default in debug builds and once per process for Android.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(parallel_snapshot_decompression, false,
+            "Decompress the read-only snapshot on a worker thread while the "
+            "startup snapshot is decompressed on the main thread.")
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_decompression)
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
@@ -2209,6 +2289,7 @@ DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_inner)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
 
 DEFINE_BOOL(predictable_gc_schedule, false,
@@ -2230,6 +2311,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_eager_inner)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
 
 //
@@ -1319,8 +1319,10 @@ void UpdateListOfYoungNodesImpl(Isolate* isolate, std::vector<T*>* node_list) {
     }
   }
   DCHECK_LE(last, node_list->size());
+  // Keep the capacity: embedders that churn through handles would otherwise
+  // regrow the list from scratch after every scavenge. The backing store is
+  // released on the next full GC in ClearListOfYoungNodesImpl().
   node_list->resize(last);
-  node_list->shrink_to_fit();
 }
 
 template <typename T>
@@ -135,6 +135,7 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
       FLAG_jitless ? JitPermission::kNoJit : JitPermission::kMapAsJittable;
 
   if (!VirtualMemoryCage::InitReservation(params)) return false;
+  AdviseHugePages(page_allocator_->begin(), page_allocator_->size());
 
   if (V8_EXTERNAL_CODE_SPACE_BOOL) {
     // Ensure that the code range does not cross the 4Gb boundary and thus
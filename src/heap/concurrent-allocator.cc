@@ -4,6 +4,8 @@
 
 #include "src/heap/concurrent-allocator.h"
 
+#include <algorithm>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/handles/persistent-handles.h"
@@ -84,6 +86,14 @@ void ConcurrentAllocator::FreeLinearAllocationArea() {
   if (lab_.IsValid() && space_->identity() == CODE_SPACE) {
     optional_scope.emplace(MemoryChunk::FromAddress(lab_.top()));
   }
+  // A TLAB that is mostly unused by now indicates that the thread allocates
+  // less than the current TLAB size in between GCs.
+  // Compare against the size actually granted for the TLAB, since
+  // |lab_size_| was already grown for the next refill.
+  if (lab_.IsValid() &&
+      static_cast<int>(lab_.limit() - lab_.top()) > last_lab_size_ / 2) {
+    lab_size_ = std::max(last_lab_size_ / 2, kLabSize);
+  }
   lab_.CloseAndMakeIterable();
 }
 
@@ -130,9 +140,14 @@ AllocationResult ConcurrentAllocator::AllocateInLabSlow(
 
 bool ConcurrentAllocator::EnsureLab(AllocationOrigin origin) {
   auto result = space_->RawRefillLabBackground(
-      local_heap_, kLabSize, kMaxLabSize, kTaggedAligned, origin);
+      local_heap_, kLabSize, lab_size_, kTaggedAligned, origin);
   if (!result) return false;
 
+  lab_refills_++;
+  lab_allocated_bytes_ += result->second;
+  last_lab_size_ = static_cast<int>(result->second);
+  lab_size_ = std::min(lab_size_ * 2, kMaxLabSize);
+
   if (IsBlackAllocationEnabled()) {
     Address top = result->first;
     Address limit = top + result->second;
@@ -155,6 +170,7 @@ AllocationResult ConcurrentAllocator::AllocateOutsideLab(
   auto result = space_->RawRefillLabBackground(local_heap_, object_size,
                                                object_size, alignment, origin);
   if (!result) return AllocationResult::Failure();
+  outside_lab_allocated_bytes_ += object_size;
 
   HeapObject object = HeapObject::FromAddress(result->first);
 
@@ -30,7 +30,10 @@ class StressConcurrentAllocatorTask : public CancelableTask {
 };
 
 // Concurrent allocator for allocation from background threads/tasks.
-// Allocations are served from a TLAB if possible.
+// Allocations are served from a TLAB if possible. The TLAB size adapts to the
+// allocation rate of the owning thread: it doubles on every refill, up to
+// kMaxLabSize, and halves again down to kLabSize if most of a TLAB is left
+// unused when the linear allocation area is freed, e.g., for a GC.
 class ConcurrentAllocator {
  public:
   static const int kLabSize = 4 * KB;
@@ -51,6 +54,16 @@ class ConcurrentAllocator {
   void MarkLinearAllocationAreaBlack();
   void UnmarkLinearAllocationArea();
 
+  // Current upper bound for the size of a TLAB refill.
+  int lab_size() const { return lab_size_; }
+  // Number of TLAB refills so far.
+  size_t lab_refills() const { return lab_refills_; }
+  // Bytes handed out in TLABs and in allocations outside of TLABs so far.
+  size_t lab_allocated_bytes() const { return lab_allocated_bytes_; }
+  size_t outside_lab_allocated_bytes() const {
+    return outside_lab_allocated_bytes_;
+  }
+
  private:
   V8_EXPORT_PRIVATE AllocationResult AllocateInLabSlow(
       int object_size, AllocationAlignment alignment, AllocationOrigin origin);
@@ -72,6 +85,13 @@ class ConcurrentAllocator {
   LocalHeap* const local_heap_;
   PagedSpace* const space_;
   LocalAllocationBuffer lab_;
+  int lab_size_ = kLabSize;
+  // Size granted for the most recent TLAB refill.
+  int last_lab_size_ = 0;
+
+  size_t lab_refills_ = 0;
+  size_t lab_allocated_bytes_ = 0;
+  size_t outside_lab_allocated_bytes_ = 0;
 };
 
 }  // namespace internal
@@ -718,8 +718,14 @@ void CppHeap::RunMinorGC(StackState stack_state) {
   if (in_no_gc_scope()) return;
   // Minor GC does not support nesting in full GCs.
   if (IsMarking()) return;
-  // Minor GCs with the stack are currently not supported.
-  if (stack_state == StackState::kMayContainHeapPointers) return;
+  if (stack_state == StackState::kMayContainHeapPointers) {
+    // Minor GCs with the stack are currently not supported. Request a scavenge
+    // task instead, which runs the minor GC without the stack, so that young
+    // C++ objects are still reclaimed when the scavenger runs on allocation
+    // failure.
+    isolate_->heap()->ScheduleScavengeTaskForCppMinorGC();
+    return;
+  }
 
   // Notify GC tracer that CppGC started young GC cycle.
   isolate_->heap()->tracer()->NotifyYoungCppGCRunning();
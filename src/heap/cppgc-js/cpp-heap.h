@@ -146,6 +146,8 @@ class V8_EXPORT_PRIVATE CppHeap final
   void EnterFinalPause(cppgc::EmbedderStackState stack_state);
   bool FinishConcurrentMarkingIfNeeded();
 
+  // Runs a minor GC right away if the stack is known to not contain heap
+  // pointers. Otherwise, a scavenge task is requested that runs it later.
   void RunMinorGC(StackState);
 
   // StatsCollector::AllocationObserver interface.
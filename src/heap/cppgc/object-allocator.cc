@@ -181,8 +181,12 @@ void ObjectAllocator::RefillLinearAllocationBuffer(NormalPageSpace& space,
     if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
   }
 
-  sweeper.FinishIfRunning();
-  // TODO(chromium:1056170): Make use of the synchronously freed memory.
+  if (sweeper.IsSweepingInProgress()) {
+    sweeper.FinishIfRunning();
+    // Finishing sweeping may have freed a suitable block in this space. Try
+    // that before growing the space by a new page.
+    if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
+  }
 
   auto* new_page = NormalPage::Create(page_backend_, space);
   space.AddPage(new_page);
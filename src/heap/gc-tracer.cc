@@ -811,21 +811,39 @@ void GCTracer::PrintNVP() const {
           "mark.roots=%.2f "
           "mark.weak=%.2f "
           "mark.global_handles=%.2f "
+          "mark.parallel=%.2f "
           "clear=%.2f "
           "clear.string_table=%.2f "
           "clear.weak_lists=%.2f "
           "evacuate=%.2f "
+          "evacuate.prologue=%.2f "
           "evacuate.copy=%.2f "
+          "evacuate.copy.parallel=%.2f "
           "evacuate.update_pointers=%.2f "
           "evacuate.update_pointers.to_new_roots=%.2f "
           "evacuate.update_pointers.slots=%.2f "
+          "evacuate.update_pointers.parallel=%.2f "
+          "evacuate.update_pointers.weak=%.2f "
+          "evacuate.rebalance=%.2f "
+          "evacuate.clean_up=%.2f "
+          "evacuate.epilogue=%.2f "
+          "complete.sweep_array_buffers=%.2f "
           "background.mark=%.2f "
           "background.evacuate.copy=%.2f "
           "background.evacuate.update_pointers=%.2f "
           "background.unmapper=%.2f "
           "unmapper=%.2f "
           "update_marking_deque=%.2f "
-          "reset_liveness=%.2f\n",
+          "reset_liveness=%.2f "
+          "total_size_before=%zu "
+          "total_size_after=%zu "
+          "allocated=%zu "
+          "promoted=%zu "
+          "semi_space_copied=%zu "
+          "promotion_ratio=%.1f%% "
+          "average_survival_ratio=%.1f%% "
+          "promotion_rate=%.1f%% "
+          "semi_space_copy_rate=%.1f%%\n",
           duration, spent_in_mutator, "mmc", current_.reduce_memory,
           current_scope(Scope::MINOR_MC),
           current_scope(Scope::TIME_TO_SAFEPOINT),
@@ -834,21 +852,35 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::MINOR_MC_MARK_ROOTS),
           current_scope(Scope::MINOR_MC_MARK_WEAK),
           current_scope(Scope::MINOR_MC_MARK_GLOBAL_HANDLES),
+          current_scope(Scope::MINOR_MC_MARK_PARALLEL),
           current_scope(Scope::MINOR_MC_CLEAR),
           current_scope(Scope::MINOR_MC_CLEAR_STRING_TABLE),
           current_scope(Scope::MINOR_MC_CLEAR_WEAK_LISTS),
           current_scope(Scope::MINOR_MC_EVACUATE),
+          current_scope(Scope::MINOR_MC_EVACUATE_PROLOGUE),
           current_scope(Scope::MINOR_MC_EVACUATE_COPY),
+          current_scope(Scope::MINOR_MC_EVACUATE_COPY_PARALLEL),
           current_scope(Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS),
           current_scope(Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_TO_NEW_ROOTS),
           current_scope(Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_SLOTS),
+          current_scope(Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_PARALLEL),
+          current_scope(Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_WEAK),
+          current_scope(Scope::MINOR_MC_EVACUATE_REBALANCE),
+          current_scope(Scope::MINOR_MC_EVACUATE_CLEAN_UP),
+          current_scope(Scope::MINOR_MC_EVACUATE_EPILOGUE),
+          current_scope(Scope::MINOR_MC_COMPLETE_SWEEP_ARRAY_BUFFERS),
           current_scope(Scope::MINOR_MC_BACKGROUND_MARKING),
           current_scope(Scope::MINOR_MC_BACKGROUND_EVACUATE_COPY),
           current_scope(Scope::MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS),
           current_scope(Scope::BACKGROUND_UNMAPPER),
           current_scope(Scope::UNMAPPER),
           current_scope(Scope::MINOR_MC_MARKING_DEQUE),
-          current_scope(Scope::MINOR_MC_RESET_LIVENESS));
+          current_scope(Scope::MINOR_MC_RESET_LIVENESS),
+          current_.start_object_size, current_.end_object_size,
+          allocated_since_last_gc, heap_->promoted_objects_size(),
+          heap_->semi_space_copied_object_size(), heap_->promotion_ratio_,
+          AverageSurvivalRatio(), heap_->promotion_rate_,
+          heap_->semi_space_copied_rate_);
       break;
     case Event::MARK_COMPACTOR:
     case Event::INCREMENTAL_MARK_COMPACTOR:
@@ -1584,12 +1616,37 @@ void GCTracer::ReportFullCycleToRecorder() {
   event.main_thread_incremental.sweep_wall_clock_duration_in_us =
       incremental_sweeping;
 
-  // TODO(chromium:1154636): Populate the following:
-  // - event.objects
-  // - event.memory
-  // - event.collection_rate_in_percent
-  // - event.efficiency_in_bytes_per_us
-  // - event.main_thread_efficiency_in_bytes_per_us
+  // Objects:
+  event.objects.bytes_before = current_.start_object_size;
+  event.objects.bytes_after = current_.end_object_size;
+  event.objects.bytes_freed =
+      current_.start_object_size > current_.end_object_size
+          ? current_.start_object_size - current_.end_object_size
+          : 0U;
+  // Memory:
+  event.memory.bytes_before = current_.start_memory_size;
+  event.memory.bytes_after = current_.end_memory_size;
+  event.memory.bytes_freed =
+      current_.start_memory_size > current_.end_memory_size
+          ? current_.start_memory_size - current_.end_memory_size
+          : 0U;
+  // Collection Rate:
+  if (event.objects.bytes_before > 0) {
+    event.collection_rate_in_percent =
+        static_cast<double>(event.objects.bytes_after) /
+        event.objects.bytes_before;
+  }
+  // Efficiency:
+  if (event.total.total_wall_clock_duration_in_us > 0) {
+    event.efficiency_in_bytes_per_us =
+        static_cast<double>(event.objects.bytes_freed) /
+        event.total.total_wall_clock_duration_in_us;
+  }
+  if (event.main_thread.total_wall_clock_duration_in_us > 0) {
+    event.main_thread_efficiency_in_bytes_per_us =
+        static_cast<double>(event.objects.bytes_freed) /
+        event.main_thread.total_wall_clock_duration_in_us;
+  }
 
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
@@ -1618,6 +1675,9 @@ void GCTracer::ReportIncrementalMarkingStepToRecorder(double v8_duration) {
   incremental_mark_batched_events_.events.back().wall_clock_duration_in_us =
       static_cast<int64_t>(v8_duration *
                            base::Time::kMicrosecondsPerMillisecond);
+  const double pause_budget = heap_->gc_pause_budget_in_ms();
+  incremental_mark_batched_events_.events.back().exceeded_pause_budget =
+      pause_budget > 0 && v8_duration > pause_budget;
   if (incremental_mark_batched_events_.events.size() == kMaxBatchedEvents) {
     FlushBatchedEvents(incremental_mark_batched_events_, heap_->isolate());
   }
@@ -12,6 +12,7 @@
 // Avoid including anything but `heap.h` from `src/heap` where possible.
 #include "src/base/atomic-utils.h"
 #include "src/base/atomicops.h"
+#include "src/base/bits.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/sanitizer/msan.h"
@@ -92,6 +93,14 @@ base::EnumSet<CodeFlushMode> Heap::GetCodeFlushMode(Isolate* isolate) {
     code_flush_mode.Add(CodeFlushMode::kStressFlushCode);
   }
 
+  // GCs that try to reduce the memory footprint (memory reducer, memory
+  // pressure notifications, near-heap-limit GCs) also flush bytecode that has
+  // not run since the previous full GC.
+  if (FLAG_flush_code_on_memory_reducing_gc && !code_flush_mode.empty() &&
+      isolate->heap()->ShouldReduceMemory()) {
+    code_flush_mode.Add(CodeFlushMode::kEagerFlushCode);
+  }
+
   return code_flush_mode;
 }
 
@@ -551,10 +560,18 @@ int Heap::MaxNumberToStringCacheSize() const {
   // Compute the size of the number string cache based on the max newspace size.
   // The number string cache has a minimum size based on twice the initial cache
   // size to ensure that it is bigger after being made 'full size'.
+  // The upper bound comes from --max-number-string-cache-entries, clamped to
+  // kMaxNumberStringCacheEntries and kept a power of two since the cache is
+  // indexed by masking the hash. Note that the max newspace size still caps
+  // the result, so raising the flag only helps with large semi-spaces.
+  size_t max_entries = base::bits::RoundUpToPowerOfTwo32(std::max(
+      std::min(FLAG_max_number_string_cache_entries,
+               static_cast<unsigned>(kMaxNumberStringCacheEntries)),
+      1u));
   size_t number_string_cache_size = max_semi_space_size_ / 512;
   number_string_cache_size =
       std::max(static_cast<size_t>(kInitialNumberStringCacheSize * 2),
-               std::min(static_cast<size_t>(0x4000), number_string_cache_size));
+               std::min(max_entries, number_string_cache_size));
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return static_cast<int>(number_string_cache_size * 2);
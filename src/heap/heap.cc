@@ -86,6 +86,7 @@
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/data-handler.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/free-space-inl.h"
@@ -395,6 +396,24 @@ size_t Heap::CommittedMemory() {
          CommittedOldGenerationMemory();
 }
 
+// Other clients allocate in the shared spaces concurrently, so the two
+// functions below only read the spaces' std::atomic committed and allocated
+// byte counters. In particular SizeOfObjects() is not used, as spaces may
+// adjust it by their linear allocation area, which is not synchronized.
+size_t Heap::SharedHeapCommittedMemory() {
+  size_t total = 0;
+  if (shared_old_space_) total += shared_old_space_->CommittedMemory();
+  if (shared_map_space_) total += shared_map_space_->CommittedMemory();
+  return total;
+}
+
+size_t Heap::SharedHeapSizeOfObjects() {
+  size_t total = 0;
+  if (shared_old_space_) total += shared_old_space_->Size();
+  if (shared_map_space_) total += shared_map_space_->Size();
+  return total;
+}
+
 size_t Heap::CommittedPhysicalMemory() {
   if (!HasBeenSetUp()) return 0;
 
@@ -1551,6 +1570,11 @@ void Heap::ScheduleScavengeTaskIfNeeded() {
   scavenge_job_->ScheduleTaskIfNeeded(this);
 }
 
+void Heap::ScheduleScavengeTaskForCppMinorGC() {
+  DCHECK_NOT_NULL(scavenge_job_);
+  scavenge_job_->ScheduleTaskForCppMinorGC(this);
+}
+
 void Heap::CollectAllGarbage(int flags, GarbageCollectionReason gc_reason,
                              const v8::GCCallbackFlags gc_callback_flags) {
   // Since we are ignoring the return value, the exact choice of space does
@@ -4279,6 +4303,8 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
 void Heap::EagerlyFreeExternalMemory() {
   array_buffer_sweeper()->EnsureFinished();
   memory_allocator()->unmapper()->EnsureUnmappingCompleted();
+  if (auto pool = isolate()->array_buffer_pool()) pool->ReleasePooledMemory();
+  isolate()->allocator()->ReleasePooledSegments();
 }
 
 void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
@@ -4322,6 +4348,20 @@ void Heap::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
       initial_max_old_generation_size_ * threshold_percent;
 }
 
+void Heap::SetGCPauseBudget(double max_pause_in_ms,
+                            double target_utilization) {
+  DCHECK_LE(0.0, max_pause_in_ms);
+  DCHECK_LE(0.0, target_utilization);
+  DCHECK_GT(1.0, target_utilization);
+  gc_pause_budget_in_ms_ = max_pause_in_ms;
+  gc_target_mutator_utilization_ = target_utilization;
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "GC pause budget set to %.1f ms (target utilization %.2f)\n",
+        max_pause_in_ms, target_utilization);
+  }
+}
+
 bool Heap::InvokeNearHeapLimitCallback() {
   if (near_heap_limit_callbacks_.size() > 0) {
     AllowGarbageCollection allow_gc;
@@ -7163,7 +7203,6 @@ size_t Heap::EmbedderAllocationCounter() const {
 }
 
 void Heap::CreateObjectStats() {
-  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
   if (!live_object_stats_) {
     live_object_stats_.reset(new ObjectStats(this));
   }
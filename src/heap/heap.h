@@ -717,6 +717,15 @@ class Heap {
   V8_EXPORT_PRIVATE void AutomaticallyRestoreInitialHeapLimit(
       double threshold_percent);
 
+  // Implements v8::Isolate::SetGCPauseBudget. A value of 0 disables the
+  // respective limit.
+  V8_EXPORT_PRIVATE void SetGCPauseBudget(double max_pause_in_ms,
+                                          double target_utilization);
+  double gc_pause_budget_in_ms() const { return gc_pause_budget_in_ms_; }
+  double gc_target_mutator_utilization() const {
+    return gc_target_mutator_utilization_;
+  }
+
   void AppendArrayBufferExtension(JSArrayBuffer object,
                                   ArrayBufferExtension* extension);
   void DetachArrayBufferExtension(JSArrayBuffer object,
@@ -851,6 +860,19 @@ class Heap {
   // Create ObjectStats if live_object_stats_ or dead_object_stats_ are nullptr.
   void CreateObjectStats();
 
+  // Object stats are not collected while disabled, e.g. during deserialization
+  // when objects may be in an invalid state. Calls nest.
+  void DisableObjectStats() {
+    object_stats_disabled_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void EnableObjectStats() {
+    DCHECK_LT(0, object_stats_disabled_count_.load(std::memory_order_relaxed));
+    object_stats_disabled_count_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  bool IsObjectStatsDisabled() const {
+    return object_stats_disabled_count_.load(std::memory_order_relaxed) > 0;
+  }
+
   // Sets the TearDown state, so no new GC tasks get posted.
   void StartTearDown();
 
@@ -1206,6 +1228,11 @@ class Heap {
 
   v8::CppHeap* cpp_heap() const { return cpp_heap_; }
 
+  // Requests a scavenge task, independent of the young generation size, for a
+  // cppgc minor GC that was skipped because the stack may contain heap
+  // pointers.
+  void ScheduleScavengeTaskForCppMinorGC();
+
   const cppgc::EmbedderStackState* overriden_stack_state() const;
 
   // ===========================================================================
@@ -1365,6 +1392,15 @@ class Heap {
   // Returns the amount of physical memory currently committed for the heap.
   size_t CommittedPhysicalMemory();
 
+  // Returns the amount of memory currently committed for the shared spaces
+  // this heap is attached to. Returns 0 if there is no shared heap.
+  size_t SharedHeapCommittedMemory();
+
+  // Returns the number of bytes allocated in the shared spaces this heap is
+  // attached to, including unused parts of linear allocation areas. Returns 0
+  // if there is no shared heap.
+  size_t SharedHeapSizeOfObjects();
+
   // Returns the maximum amount of memory ever committed for the heap.
   size_t MaximumCommittedMemory() { return maximum_committed_; }
 
@@ -1759,6 +1795,9 @@ class Heap {
 
   static const int kInitialEvalCacheSize = 64;
   static const int kInitialNumberStringCacheSize = 256;
+  // Upper bound for --max-number-string-cache-entries, so that the rounded-up
+  // entry count neither overflows nor exceeds the FixedArray length limit.
+  static const int kMaxNumberStringCacheEntries = 1 << 24;
 
   static const int kRememberedUnmappedPages = 128;
 
@@ -2205,6 +2244,11 @@ class Heap {
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
+  // Embedder-provided budget for main-thread incremental GC steps, see
+  // v8::Isolate::SetGCPauseBudget. 0 means no budget.
+  double gc_pause_budget_in_ms_ = 0.0;
+  double gc_target_mutator_utilization_ = 0.0;
+
   // For keeping track of context disposals.
   int contexts_disposed_ = 0;
 
@@ -2268,6 +2312,9 @@ class Heap {
   // How many mark-sweep collections happened.
   unsigned int ms_count_ = 0;
 
+  // Number of active DisableObjectStats() calls.
+  std::atomic<int> object_stats_disabled_count_{0};
+
   // How many gc happened.
   unsigned int gc_count_ = 0;
 
@@ -173,6 +173,7 @@ void IncrementalMarking::Start(GarbageCollectionReason gc_reason) {
   scheduled_bytes_to_mark_ = 0;
   schedule_update_time_ms_ = start_time_ms_;
   bytes_marked_concurrently_ = 0;
+  next_allocation_step_time_ms_ = 0.0;
   was_activated_ = true;
 
   StartMarking();
@@ -886,13 +887,28 @@ void IncrementalMarking::AdvanceOnAllocation() {
   TRACE_GC_EPOCH(heap_->tracer(), GCTracer::Scope::MC_INCREMENTAL,
                  ThreadKind::kMain);
   ScheduleBytesToMarkBasedOnAllocation();
+  // Respect the mutator utilization requested by the embedder by not
+  // performing allocation-driven steps too close to each other. The schedule
+  // is still updated above, so that skipped work is picked up by later steps.
+  const double now = heap_->MonotonicallyIncreasingTimeInMs();
+  if (now < next_allocation_step_time_ms_) return;
   Step(kMaxStepSizeInMs, GC_VIA_STACK_GUARD, StepOrigin::kV8);
+  const double utilization = heap_->gc_target_mutator_utilization();
+  if (utilization > 0) {
+    const double end = heap_->MonotonicallyIncreasingTimeInMs();
+    next_allocation_step_time_ms_ =
+        end + (end - now) * utilization / (1 - utilization);
+  }
 }
 
 StepResult IncrementalMarking::Step(double max_step_size_in_ms,
                                     CompletionAction action,
                                     StepOrigin step_origin) {
   double start = heap_->MonotonicallyIncreasingTimeInMs();
+  const double pause_budget = heap_->gc_pause_budget_in_ms();
+  if (pause_budget > 0) {
+    max_step_size_in_ms = std::min(max_step_size_in_ms, pause_budget);
+  }
 
   StepResult combined_result = StepResult::kMoreWorkRemaining;
   size_t bytes_to_process = 0;
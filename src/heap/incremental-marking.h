@@ -216,6 +216,8 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   void MarkRootsForTesting();
 
+  size_t bytes_marked_for_testing() const { return bytes_marked_; }
+
  private:
   class Observer : public AllocationObserver {
    public:
@@ -289,6 +291,9 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // incremental marking step. It is used for updating
   // bytes_marked_ahead_of_schedule_ with contribution of concurrent marking.
   size_t bytes_marked_concurrently_ = 0;
+  // Earliest time at which the next allocation-driven step may run in order
+  // to respect Heap::gc_target_mutator_utilization().
+  double next_allocation_step_time_ms_ = 0.0;
 
   // Must use SetState() above to update state_
   // Atomic since main thread can complete marking (= changing state), while a
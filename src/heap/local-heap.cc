@@ -30,6 +30,19 @@ namespace internal {
 
 namespace {
 thread_local LocalHeap* current_local_heap = nullptr;
+
+void PrintAllocatorStatistics(Isolate* isolate, LocalHeap* local_heap,
+                              const char* space_name,
+                              const ConcurrentAllocator* allocator) {
+  if (!allocator) return;
+  PrintIsolate(isolate,
+               "local-heap: local_heap=%p space=%s lab_refills=%zu "
+               "lab_bytes=%zu outside_lab_bytes=%zu lab_size=%d\n",
+               static_cast<void*>(local_heap), space_name,
+               allocator->lab_refills(), allocator->lab_allocated_bytes(),
+               allocator->outside_lab_allocated_bytes(),
+               allocator->lab_size());
+}
 }  // namespace
 
 LocalHeap* LocalHeap::Current() { return current_local_heap; }
@@ -97,6 +110,16 @@ LocalHeap::~LocalHeap() {
     current_local_heap = nullptr;
   }
 
+  if (FLAG_trace_gc_verbose) {
+    Isolate* isolate = heap_->isolate();
+    PrintAllocatorStatistics(isolate, this, "old_space",
+                             old_space_allocator_.get());
+    PrintAllocatorStatistics(isolate, this, "code_space",
+                             code_space_allocator_.get());
+    PrintAllocatorStatistics(isolate, this, "shared_old_space",
+                             shared_old_space_allocator_.get());
+  }
+
   DCHECK(gc_epilogue_callbacks_.empty());
 }
 
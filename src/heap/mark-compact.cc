@@ -4,6 +4,8 @@
 
 #include "src/heap/mark-compact.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -835,6 +837,11 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   CodePageHeaderModificationScope rwx_write_scope(
       "Modification of Code page header flags requires write access");
 
+  // Histogram of evacuable pages bucketed by their live ratio in steps of
+  // 10%. Only used for --trace-fragmentation.
+  static constexpr int kLiveRatioBuckets = 10;
+  std::array<int, kLiveRatioBuckets> live_ratio_histogram{};
+
   DCHECK(!sweeping_in_progress());
   Page* owner_of_linear_allocation_area =
       space->top() == space->limit()
@@ -860,6 +867,12 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     CHECK_NULL(p->typed_slot_set<OLD_TO_OLD>());
     CHECK(p->SweepingDone());
     DCHECK(p->area_size() == area_size);
+    if (V8_UNLIKELY(FLAG_trace_fragmentation)) {
+      const size_t bucket =
+          std::min<size_t>(p->allocated_bytes() * kLiveRatioBuckets / area_size,
+                           kLiveRatioBuckets - 1);
+      live_ratio_histogram[bucket]++;
+    }
     if (in_standard_path) {
       // Only the pages with at more than |free_bytes_threshold| free bytes are
       // considered for evacuation.
@@ -956,6 +969,16 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
                  "total_live_bytes=%zu\n",
                  space->name(), reduce_memory, candidate_count,
                  total_live_bytes / KB);
+    PrintIsolate(isolate(),
+                 "compaction-histogram: space=%s live_ratio_percent "
+                 "0-10=%d 10-20=%d 20-30=%d 30-40=%d 40-50=%d 50-60=%d "
+                 "60-70=%d 70-80=%d 80-90=%d 90-100=%d\n",
+                 space->name(), live_ratio_histogram[0],
+                 live_ratio_histogram[1], live_ratio_histogram[2],
+                 live_ratio_histogram[3], live_ratio_histogram[4],
+                 live_ratio_histogram[5], live_ratio_histogram[6],
+                 live_ratio_histogram[7], live_ratio_histogram[8],
+                 live_ratio_histogram[9]);
   }
 }
 
@@ -2419,9 +2442,17 @@ void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
 }
 
 void MarkCompactCollector::RecordObjectStats() {
-  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
-  // Cannot run during bootstrapping due to incomplete objects.
+  const bool sample_object_stats =
+      FLAG_gc_object_stats_sampling_interval > 0 &&
+      heap()->ms_count() % FLAG_gc_object_stats_sampling_interval == 0;
+  if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled() &&
+                 !sample_object_stats)) {
+    return;
+  }
+  // Cannot run during bootstrapping or deserialization due to incomplete
+  // objects.
   if (isolate()->bootstrapper()->IsActive()) return;
+  if (heap()->IsObjectStatsDisabled()) return;
   heap()->CreateObjectStats();
   ObjectStatsCollector collector(heap(), heap()->live_object_stats_.get(),
                                  heap()->dead_object_stats_.get());
@@ -2759,6 +2790,9 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   Address compiled_data_start = compiled_data.address();
   int compiled_data_size = compiled_data.Size();
   MemoryChunk* chunk = MemoryChunk::FromAddress(compiled_data_start);
+  isolate()->counters()->flushed_bytecode_arrays()->Increment();
+  isolate()->counters()->flushed_bytecode_bytes()->Increment(
+      compiled_data_size);
 
   // Clear any recorded slots for the compiled data as being invalid.
   RememberedSet<OLD_TO_NEW>::RemoveRange(
@@ -4314,7 +4348,8 @@ class PointersUpdatingJob : public v8::JobTask {
       Isolate* isolate,
       std::vector<std::unique_ptr<UpdatingItem>> updating_items,
       GCTracer::Scope::ScopeId scope, GCTracer::Scope::ScopeId background_scope)
-      : updating_items_(std::move(updating_items)),
+      : isolate_(isolate),
+        updating_items_(std::move(updating_items)),
         remaining_updating_items_(updating_items_.size()),
         generator_(updating_items_.size()),
         tracer_(isolate->heap()->tracer()),
@@ -4322,29 +4357,47 @@ class PointersUpdatingJob : public v8::JobTask {
         background_scope_(background_scope) {}
 
   void Run(JobDelegate* delegate) override {
+    Heap* heap = isolate_->heap();
+    const double start = V8_UNLIKELY(FLAG_trace_evacuation)
+                             ? heap->MonotonicallyIncreasingTimeInMs()
+                             : 0.0;
+    size_t items_processed = 0;
     if (delegate->IsJoiningThread()) {
       TRACE_GC(tracer_, scope_);
-      UpdatePointers(delegate);
+      items_processed = UpdatePointers(delegate);
     } else {
       TRACE_GC_EPOCH(tracer_, background_scope_, ThreadKind::kBackground);
-      UpdatePointers(delegate);
+      items_processed = UpdatePointers(delegate);
+    }
+    if (V8_UNLIKELY(FLAG_trace_evacuation)) {
+      // Per-task statistics allow to judge how evenly the work is distributed.
+      PrintIsolate(isolate_,
+                   "pointers-updating-task: task_id=%d joining_thread=%d "
+                   "items=%zu total_items=%zu time=%.2f\n",
+                   delegate->GetTaskId(), delegate->IsJoiningThread(),
+                   items_processed, updating_items_.size(),
+                   heap->MonotonicallyIncreasingTimeInMs() - start);
     }
   }
 
-  void UpdatePointers(JobDelegate* delegate) {
+  // Returns the number of items processed by this invocation.
+  size_t UpdatePointers(JobDelegate* delegate) {
+    size_t items_processed = 0;
     while (remaining_updating_items_.load(std::memory_order_relaxed) > 0) {
       base::Optional<size_t> index = generator_.GetNext();
-      if (!index) return;
+      if (!index) return items_processed;
       for (size_t i = *index; i < updating_items_.size(); ++i) {
         auto& work_item = updating_items_[i];
         if (!work_item->TryAcquire()) break;
         work_item->Process();
+        items_processed++;
         if (remaining_updating_items_.fetch_sub(1, std::memory_order_relaxed) <=
             1) {
-          return;
+          return items_processed;
         }
       }
     }
+    return items_processed;
   }
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -4357,6 +4410,7 @@ class PointersUpdatingJob : public v8::JobTask {
   }
 
  private:
+  Isolate* const isolate_;
   std::vector<std::unique_ptr<UpdatingItem>> updating_items_;
   std::atomic<size_t> remaining_updating_items_{0};
   IndexGenerator generator_;
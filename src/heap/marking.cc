@@ -9,6 +9,43 @@ namespace internal {
 
 const size_t Bitmap::kSize = Bitmap::CellsCount() * Bitmap::kBytesPerCell;
 
+namespace {
+
+// Cells are checked in blocks of this many cells. Within a block the cells are
+// combined without data-dependent branches, which allows the compiler to
+// vectorize the inner loop; the early exit is only taken once per block.
+constexpr size_t kCellsPerBlock = 8;
+
+// Returns true if all cells in [start, end) are zero.
+bool AllCellsClear(const MarkBit::CellType* cells, size_t start, size_t end) {
+  size_t i = start;
+  for (; i + kCellsPerBlock <= end; i += kCellsPerBlock) {
+    MarkBit::CellType combined = 0;
+    for (size_t j = 0; j < kCellsPerBlock; j++) combined |= cells[i + j];
+    if (combined != 0) return false;
+  }
+  for (; i < end; i++) {
+    if (cells[i] != 0) return false;
+  }
+  return true;
+}
+
+// Returns true if all cells in [start, end) have all bits set.
+bool AllCellsSet(const MarkBit::CellType* cells, size_t start, size_t end) {
+  size_t i = start;
+  for (; i + kCellsPerBlock <= end; i += kCellsPerBlock) {
+    MarkBit::CellType combined = ~0u;
+    for (size_t j = 0; j < kCellsPerBlock; j++) combined &= cells[i + j];
+    if (combined != ~0u) return false;
+  }
+  for (; i < end; i++) {
+    if (cells[i] != ~0u) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 template <>
 bool ConcurrentBitmap<AccessMode::NON_ATOMIC>::AllBitsSetInRange(
     uint32_t start_index, uint32_t end_index) {
@@ -27,8 +64,8 @@ bool ConcurrentBitmap<AccessMode::NON_ATOMIC>::AllBitsSetInRange(
     if ((cells()[start_cell_index] & matching_mask) != matching_mask) {
       return false;
     }
-    for (unsigned int i = start_cell_index + 1; i < end_cell_index; i++) {
-      if (cells()[i] != ~0u) return false;
+    if (!AllCellsSet(cells(), start_cell_index + 1, end_cell_index)) {
+      return false;
     }
     matching_mask = end_index_mask | (end_index_mask - 1);
     return ((cells()[end_cell_index] & matching_mask) == matching_mask);
@@ -54,8 +91,8 @@ bool ConcurrentBitmap<AccessMode::NON_ATOMIC>::AllBitsClearInRange(
   if (start_cell_index != end_cell_index) {
     matching_mask = ~(start_index_mask - 1);
     if ((cells()[start_cell_index] & matching_mask)) return false;
-    for (unsigned int i = start_cell_index + 1; i < end_cell_index; i++) {
-      if (cells()[i]) return false;
+    if (!AllCellsClear(cells(), start_cell_index + 1, end_cell_index)) {
+      return false;
     }
     matching_mask = end_index_mask | (end_index_mask - 1);
     return !(cells()[end_cell_index] & matching_mask);
@@ -129,12 +166,7 @@ void ConcurrentBitmap<AccessMode::NON_ATOMIC>::Print() {
 
 template <>
 bool ConcurrentBitmap<AccessMode::NON_ATOMIC>::IsClean() {
-  for (size_t i = 0; i < CellsCount(); i++) {
-    if (cells()[i] != 0) {
-      return false;
-    }
-  }
-  return true;
+  return AllCellsClear(cells(), 0, CellsCount());
 }
 
 }  // namespace internal
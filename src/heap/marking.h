@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_MARKING_H_
 #define V8_HEAP_MARKING_H_
 
+#include <cstring>
+
 #include "src/base/atomic-utils.h"
 #include "src/utils/utils.h"
 
@@ -201,9 +203,11 @@ inline void ConcurrentBitmap<AccessMode::ATOMIC>::ClearCellRangeRelaxed(
 template <>
 inline void ConcurrentBitmap<AccessMode::NON_ATOMIC>::ClearCellRangeRelaxed(
     uint32_t start_cell_index, uint32_t end_cell_index) {
-  for (uint32_t i = start_cell_index; i < end_cell_index; i++) {
-    cells()[i] = 0;
-  }
+  if (start_cell_index >= end_cell_index) return;
+  // memset() is vectorized by the C library and beats a loop of single-cell
+  // stores for the page-sized ranges used when clearing whole bitmaps.
+  memset(cells() + start_cell_index, 0,
+         (end_cell_index - start_cell_index) * Bitmap::kBytesPerCell);
 }
 
 template <>
@@ -218,9 +222,9 @@ inline void ConcurrentBitmap<AccessMode::ATOMIC>::SetCellRangeRelaxed(
 template <>
 inline void ConcurrentBitmap<AccessMode::NON_ATOMIC>::SetCellRangeRelaxed(
     uint32_t start_cell_index, uint32_t end_cell_index) {
-  for (uint32_t i = start_cell_index; i < end_cell_index; i++) {
-    cells()[i] = 0xffffffff;
-  }
+  if (start_cell_index >= end_cell_index) return;
+  memset(cells() + start_cell_index, 0xff,
+         (end_cell_index - start_cell_index) * Bitmap::kBytesPerCell);
 }
 
 template <AccessMode mode>
@@ -17,6 +17,7 @@
 #include "src/heap/mark-compact.h"
 #include "src/logging/counters.h"
 #include "src/objects/compilation-cache-table-inl.h"
+#include "src/objects/descriptor-array-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-collection-inl.h"
@@ -785,6 +786,12 @@ void ObjectStatsCollectorImpl::CollectStatistics(
       size_t over_allocated = ObjectStats::kNoOverAllocation;
       if (InstanceTypeChecker::IsJSObject(instance_type)) {
         over_allocated = map.instance_size() - map.UsedInstanceSize();
+      } else if (InstanceTypeChecker::IsDescriptorArray(instance_type)) {
+        // Descriptor arrays are shared along a transition tree and grow with
+        // slack, which is worth tracking separately from the used entries.
+        over_allocated =
+            DescriptorArray::cast(obj).number_of_slack_descriptors() *
+            DescriptorArray::kEntrySize * kTaggedSize;
       }
       RecordObjectStats(obj, instance_type, obj.Size(cage_base()),
                         over_allocated);
@@ -40,14 +40,23 @@ bool ScavengeJob::YoungGenerationSizeTaskTriggerReached(Heap* heap) {
 void ScavengeJob::ScheduleTaskIfNeeded(Heap* heap) {
   if (FLAG_scavenge_task && !task_pending_ && !heap->IsTearingDown() &&
       YoungGenerationSizeTaskTriggerReached(heap)) {
-    v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
-    auto taskrunner =
-        V8::GetCurrentPlatform()->GetForegroundTaskRunner(isolate);
-    if (taskrunner->NonNestableTasksEnabled()) {
-      taskrunner->PostNonNestableTask(
-          std::make_unique<Task>(heap->isolate(), this));
-      task_pending_ = true;
-    }
+    PostTask(heap);
+  }
+}
+
+void ScavengeJob::ScheduleTaskForCppMinorGC(Heap* heap) {
+  if (!FLAG_scavenge_task || heap->IsTearingDown()) return;
+  cpp_minor_gc_requested_ = true;
+  if (!task_pending_) PostTask(heap);
+}
+
+void ScavengeJob::PostTask(Heap* heap) {
+  v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(isolate);
+  if (taskrunner->NonNestableTasksEnabled()) {
+    taskrunner->PostNonNestableTask(
+        std::make_unique<Task>(heap->isolate(), this));
+    task_pending_ = true;
   }
 }
 
@@ -55,7 +64,12 @@ void ScavengeJob::Task::RunInternal() {
   VMState<GC> state(isolate());
   TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8", "V8.Task");
 
-  if (ScavengeJob::YoungGenerationSizeTaskTriggerReached(isolate()->heap())) {
+  // A scavenge from this task runs the cppgc minor GC without the stack, so a
+  // pending request is consumed by it as well.
+  const bool cpp_minor_gc_requested = job_->cpp_minor_gc_requested_;
+  job_->cpp_minor_gc_requested_ = false;
+  if (cpp_minor_gc_requested ||
+      ScavengeJob::YoungGenerationSizeTaskTriggerReached(isolate()->heap())) {
     isolate()->heap()->CollectGarbage(NEW_SPACE,
                                       GarbageCollectionReason::kTask);
   }
@@ -21,6 +21,11 @@ class ScavengeJob {
 
   void ScheduleTaskIfNeeded(Heap* heap);
 
+  // Schedules a task that scavenges regardless of the young generation size,
+  // so that the cppgc minor GC, which requires a task, gets to run. Coalesces
+  // with a task that is already pending.
+  void ScheduleTaskForCppMinorGC(Heap* heap);
+
   static size_t YoungGenerationTaskTriggerSize(Heap* heap);
 
  private:
@@ -28,9 +33,12 @@ class ScavengeJob {
 
   static bool YoungGenerationSizeTaskTriggerReached(Heap* heap);
 
+  void PostTask(Heap* heap);
+
   void set_task_pending(bool value) { task_pending_ = value; }
 
   bool task_pending_ = false;
+  bool cpp_minor_gc_requested_ = false;
 };
 }  // namespace internal
 }  // namespace v8
@@ -144,7 +144,10 @@ void Sweeper::TearDown() {
 
 void Sweeper::StartSweeping() {
   sweeping_in_progress_ = true;
-  should_reduce_memory_ = heap_->ShouldReduceMemory();
+  // Discarding unused system pages of swept pages would split transparent huge
+  // pages into regular ones again.
+  should_reduce_memory_ =
+      heap_->ShouldReduceMemory() && !FLAG_transparent_huge_pages;
   MajorNonAtomicMarkingState* marking_state =
       heap_->mark_compact_collector()->non_atomic_marking_state();
   ForAllSweepingSpaces([this, marking_state](AllocationSpace space) {
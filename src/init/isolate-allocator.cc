@@ -108,6 +108,8 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  AdviseHugePages(GetProcessWidePtrComprCage()->base(),
+                  params.reservation_size);
 #endif
 }
 
@@ -119,6 +121,7 @@ IsolateAllocator::IsolateAllocator() {
         nullptr,
         "Failed to reserve memory for Isolate V8 pointer compression cage");
   }
+  AdviseHugePages(isolate_ptr_compr_cage_.base(), params.reservation_size);
   page_allocator_ = isolate_ptr_compr_cage_.page_allocator();
   CommitPagesForIsolate();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
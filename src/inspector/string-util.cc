@@ -7,6 +7,8 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <memory>
 
 #include "src/base/platform/platform.h"
 #include "src/inspector/protocol/Protocol.h"
@@ -148,6 +150,25 @@ String16 toProtocolString(v8::Isolate* isolate, v8::Local<v8::String> value) {
   return String16(buffer.get(), value->Length());
 }
 
+bool protocolStringEquals(v8::Isolate* isolate, v8::Local<v8::String> value,
+                          const String16& string) {
+  if (value.IsEmpty() || value->IsNullOrUndefined()) return string.isEmpty();
+  const int length = value->Length();
+  if (static_cast<size_t>(length) != string.length()) return false;
+  if (length == 0) return true;
+  // Most function names and URLs are short, avoid the heap in that case.
+  static constexpr int kInlineBufferSize = 64;
+  uint16_t inline_buffer[kInlineBufferSize];
+  std::unique_ptr<uint16_t[]> heap_buffer;
+  uint16_t* buffer = inline_buffer;
+  if (length > kInlineBufferSize) {
+    heap_buffer.reset(new uint16_t[length]);
+    buffer = heap_buffer.get();
+  }
+  value->Write(isolate, buffer, 0, length);
+  return memcmp(buffer, string.characters16(), length * sizeof(UChar)) == 0;
+}
+
 String16 toProtocolStringWithTypeCheck(v8::Isolate* isolate,
                                        v8::Local<v8::Value> value) {
   if (value.IsEmpty() || !value->IsString()) return String16();
@@ -69,6 +69,9 @@ v8::Local<v8::String> toV8String(v8::Isolate*, const StringView&);
 // TODO(dgozman): rename to toString16.
 String16 toProtocolString(v8::Isolate*, v8::Local<v8::String>);
 String16 toProtocolStringWithTypeCheck(v8::Isolate*, v8::Local<v8::Value>);
+// Compares without materializing a String16 for |value|.
+bool protocolStringEquals(v8::Isolate*, v8::Local<v8::String> value,
+                          const String16&);
 String16 toString16(const StringView&);
 StringView toStringView(const String16&);
 template <size_t N>
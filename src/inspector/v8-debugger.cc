@@ -1136,17 +1136,21 @@ std::shared_ptr<StackFrame> V8Debugger::symbolize(
   int lineNumber = location.GetLineNumber();
   int columnNumber = location.GetColumnNumber();
   CachedStackFrameKey key{scriptId, lineNumber, columnNumber};
-  auto functionName = toProtocolString(isolate(), v8Frame->GetFunctionName());
+  v8::Local<v8::String> v8FunctionName = v8Frame->GetFunctionName();
   auto it = m_cachedStackFrames.find(key);
   if (it != m_cachedStackFrames.end() && !it->second.expired()) {
     auto stackFrame = it->second.lock();
-    if (stackFrame->functionName() == functionName) {
+    // Async stack capture symbolizes every frame on every scheduled task,
+    // so keep the cache hit path free of String16 allocations.
+    if (protocolStringEquals(isolate(), v8FunctionName,
+                             stackFrame->functionName())) {
       DCHECK_EQ(
           stackFrame->sourceURL(),
           toProtocolString(isolate(), v8Frame->GetScriptNameOrSourceURL()));
       return stackFrame;
     }
   }
+  auto functionName = toProtocolString(isolate(), v8FunctionName);
   auto sourceURL =
       toProtocolString(isolate(), v8Frame->GetScriptNameOrSourceURL());
   auto hasSourceURLComment =
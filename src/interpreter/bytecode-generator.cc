@@ -2532,10 +2532,12 @@ void BytecodeGenerator::AddToEagerLiteralsIfEager(FunctionLiteral* literal) {
   // position collection).
   if (!script_.is_null() && literal->should_parallel_compile()) {
     // If we should normally be eagerly compiling this function, we must be here
-    // because of post_parallel_compile_tasks_for_eager_toplevel.
+    // because of post_parallel_compile_tasks_for_eager_toplevel or
+    // post_parallel_compile_tasks_for_eager_inner.
     DCHECK_IMPLIES(
         literal->ShouldEagerCompile(),
-        info()->flags().post_parallel_compile_tasks_for_eager_toplevel());
+        info()->flags().post_parallel_compile_tasks_for_eager_toplevel() ||
+            info()->flags().post_parallel_compile_tasks_for_eager_inner());
     // There exists a lazy compile dispatcher.
     DCHECK(info()->dispatcher());
     // There exists a cloneable character stream.
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/build_config.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -19,6 +20,10 @@
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -1212,6 +1217,66 @@ void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
   }
 }
 
+namespace {
+
+// Skips 16-byte blocks which contain no character that may terminate a JSON
+// string ('"', '\\' or a control character). Returns the first terminating
+// character, or the start of the remaining partial block. For two-byte input
+// the skipped characters are accumulated into |bits| like the scalar loop in
+// ScanJsonString does, so that the one-byte conversion check stays correct.
+template <typename Char>
+const Char* SkipNonTerminatingBlocks(const Char* cursor, const Char* end,
+                                     base::uc32* bits) {
+#if V8_HOST_HAS_SSE2
+  constexpr int kCharsPerBlock = 16 / sizeof(Char);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i quote, backslash, control_mask;
+  if (sizeof(Char) == 1) {
+    quote = _mm_set1_epi8('"');
+    backslash = _mm_set1_epi8('\\');
+    control_mask = _mm_set1_epi8(static_cast<int8_t>(0xE0));
+  } else {
+    quote = _mm_set1_epi16('"');
+    backslash = _mm_set1_epi16('\\');
+    control_mask = _mm_set1_epi16(static_cast<int16_t>(0xFFE0));
+  }
+  __m128i seen = zero;
+  while (end - cursor >= kCharsPerBlock) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i matches;
+    if (sizeof(Char) == 1) {
+      matches = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                       _mm_cmpeq_epi8(chars, backslash)),
+          _mm_cmpeq_epi8(_mm_and_si128(chars, control_mask), zero));
+    } else {
+      matches = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                       _mm_cmpeq_epi16(chars, backslash)),
+          _mm_cmpeq_epi16(_mm_and_si128(chars, control_mask), zero));
+    }
+    int mask = _mm_movemask_epi8(matches);
+    if (mask != 0) {
+      // Let the scalar loop handle this block, it takes care of |bits|.
+      break;
+    }
+    if (sizeof(Char) == 2) seen = _mm_or_si128(seen, chars);
+    cursor += kCharsPerBlock;
+  }
+  if (sizeof(Char) == 2) {
+    // Any character above Latin1 forces the two-byte representation.
+    __m128i high_byte = _mm_and_si128(
+        seen, _mm_set1_epi16(static_cast<int16_t>(0xFF00)));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_byte, zero)) != 0xFFFF) {
+      *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+  }
+#endif
+  return cursor;
+}
+
+}  // namespace
+
 template <typename Char>
 JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   DisallowGarbageCollection no_gc;
@@ -1221,6 +1286,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipNonTerminatingBlocks(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
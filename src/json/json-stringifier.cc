@@ -4,6 +4,7 @@
 
 #include "src/json/json-stringifier.h"
 
+#include "src/base/build_config.h"
 #include "src/base/strings.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
@@ -17,6 +18,10 @@
 #include "src/strings/string-builder-inl.h"
 #include "src/utils/utils.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -127,6 +132,12 @@ class JsonStringifier {
   Isolate* isolate_;
   IncrementalStringBuilder builder_;
   Handle<String> tojson_string_;
+  // The last receiver map for which the toJSON lookup found nothing, and the
+  // validity cell of its prototype chain at that time. Both are undefined if
+  // there is no such map. The handles are allocated in the outer scope and
+  // patched in place.
+  Handle<Object> map_without_tojson_;
+  Handle<Object> map_without_tojson_validity_cell_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
   base::uc16* gap_;
@@ -220,6 +231,12 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       indent_(0),
       stack_() {
   tojson_string_ = factory()->toJSON_string();
+  // These are patched in place, so they must not alias the root handles
+  // returned by the factory.
+  map_without_tojson_ =
+      handle(ReadOnlyRoots(isolate_).undefined_value(), isolate_);
+  map_without_tojson_validity_cell_ =
+      handle(ReadOnlyRoots(isolate_).undefined_value(), isolate_);
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -331,13 +348,37 @@ MaybeHandle<Object> JsonStringifier::ApplyToJsonFunction(Handle<Object> object,
                                                          Handle<Object> key) {
   HandleScope scope(isolate_);
 
+  // Records of the same shape are common, so remember the last map without a
+  // toJSON property. The validity cell guards against toJSON being added to
+  // the prototype chain later on, like for the LoadIC's non-existent handler.
+  if (HeapObject::cast(*object).map() == *map_without_tojson_) {
+    Object cell = *map_without_tojson_validity_cell_;
+    if (cell.IsSmi() ||
+        Cell::cast(cell).value() == Smi::FromInt(Map::kPrototypeChainValid)) {
+      return object;
+    }
+  }
+
   // Retrieve toJSON function. The LookupIterator automatically handles
   // the ToObject() equivalent ("GetRoot") if {object} is a BigInt.
   Handle<Object> fun;
   LookupIterator it(isolate_, object, tojson_string_,
                     LookupIterator::PROTOTYPE_CHAIN_SKIP_INTERCEPTOR);
   ASSIGN_RETURN_ON_EXCEPTION(isolate_, fun, Object::GetProperty(&it), Object);
-  if (!fun->IsCallable()) return object;
+  if (!fun->IsCallable()) {
+    if (it.state() == LookupIterator::NOT_FOUND && object->IsJSObject()) {
+      Handle<Map> map(HeapObject::cast(*object).map(), isolate_);
+      // Only fast-mode, non-prototype maps describe all own properties.
+      if (!map->is_dictionary_map() && !map->is_prototype_map() &&
+          !map->is_access_check_needed()) {
+        Handle<Object> cell =
+            Map::GetOrCreatePrototypeChainValidityCell(map, isolate_);
+        map_without_tojson_.PatchValue(*map);
+        map_without_tojson_validity_cell_.PatchValue(*cell);
+      }
+    }
+    return object;
+  }
 
   // Call toJSON function.
   if (key->IsSmi()) key = factory()->NumberToString(key);
@@ -930,6 +971,35 @@ JsonStringifier::Result JsonStringifier::SerializeJSProxy(
   return SUCCESS;
 }
 
+namespace {
+
+// Returns the number of leading characters in [chars, chars + length) which
+// JsonStringifier::DoNotEscape accepts, looking at 16 characters at a time.
+// The result is only a lower bound: the last partial block is left to the
+// caller.
+int CountUnescapedOneByteBlocks(const uint8_t* chars, int length) {
+  int count = 0;
+#if V8_HOST_HAS_SSE2
+  // As signed bytes, [0x23, 0x7E] are exactly the values greater than 0x22
+  // and less than 0x7F.
+  const __m128i lower = _mm_set1_epi8(0x22);
+  const __m128i upper = _mm_set1_epi8(0x7F);
+  const __m128i backslash = _mm_set1_epi8(0x5C);
+  while (length - count >= 16) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + count));
+    __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(block, lower),
+                                     _mm_cmplt_epi8(block, upper));
+    __m128i ok = _mm_andnot_si128(_mm_cmpeq_epi8(block, backslash), in_range);
+    if (_mm_movemask_epi8(ok) != 0xFFFF) break;
+    count += 16;
+  }
+#endif
+  return count;
+}
+
+}  // namespace
+
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeStringUnchecked_(
     base::Vector<const SrcChar> src,
@@ -938,6 +1008,16 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    if constexpr (std::is_same<SrcChar, uint8_t>::value &&
+                  std::is_same<DestChar, uint8_t>::value) {
+      // Copy runs of characters that don't need escaping in bulk.
+      int run = CountUnescapedOneByteBlocks(src.begin() + i, src.length() - i);
+      if (run > 0) {
+        dest->AppendChars(src.begin() + i, run);
+        i += run;
+        if (i == src.length()) break;
+      }
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
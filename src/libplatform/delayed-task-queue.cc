@@ -46,12 +46,17 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
 std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   base::MutexGuard guard(&lock_);
   for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
-    double now = MonotonicallyIncreasingTime();
-    std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-    while (task) {
-      task_queue_.push(std::move(task));
-      task = PopTaskFromDelayedQueue(now);
+    // Move delayed tasks that have hit their deadline to the main queue. Only
+    // query the clock if there are delayed tasks, since this runs under
+    // {lock_} on every worker wakeup.
+    double now = 0;
+    if (!delayed_task_queue_.empty()) {
+      now = MonotonicallyIncreasingTime();
+      std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
+      while (task) {
+        task_queue_.push(std::move(task));
+        task = PopTaskFromDelayedQueue(now);
+      }
     }
     if (!task_queue_.empty()) {
       std::unique_ptr<Task> result = std::move(task_queue_.front());
@@ -291,7 +291,10 @@ namespace internal {
      the root SharedFunctionInfo */                                  \
   SC(compilation_cache_partial_hits, V8.CompilationCachePartialHits) \
   SC(objs_since_last_young, V8.ObjsSinceLastYoung)                   \
-  SC(objs_since_last_full, V8.ObjsSinceLastFull)
+  SC(objs_since_last_full, V8.ObjsSinceLastFull)                     \
+  SC(flushed_bytecode_arrays, V8.FlushedBytecodeArrays)              \
+  SC(flushed_bytecode_bytes, V8.FlushedBytecodeBytes)                \
+  SC(code_cache_duplicate_scripts, V8.CodeCacheDuplicateScripts)
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
   SC(gc_compactor_caused_by_request, V8.GCCompactorCausedByRequest)            \
@@ -79,7 +79,8 @@ class LogFile {
       return *this;
     }
 
-    // Finish the current log line an flush the it to the log file.
+    // Finish the current log line. The output stream is only flushed when the
+    // log file is closed (or its buffer fills up).
     void WriteToLogFile();
 
    private:
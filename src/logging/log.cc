@@ -2278,7 +2278,12 @@ void ExistingCodeLogger::LogCompiledFunctions() {
   // GetScriptLineNumber call.
   for (auto& pair : compiled_funcs) {
     Handle<SharedFunctionInfo> shared = pair.first;
-    SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate_, shared);
+    // Collecting lazy source positions reparses the function on the main
+    // thread, which can stall for a long time on large heaps. Without them
+    // the function is still logged, just without a line table.
+    if (FLAG_log_existing_code_source_positions) {
+      SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate_, shared);
+    }
     if (shared->HasInterpreterData()) {
       LogExistingFunction(
           shared,
@@ -486,6 +486,7 @@ class RuntimeCallTimer final {
   V(WebSnapshotDeserialize_Arrays)             \
   V(WebSnapshotDeserialize_BuiltinObjects)     \
   V(WebSnapshotDeserialize_Classes)            \
+  V(WebSnapshotDeserialize_Collections)        \
   V(WebSnapshotDeserialize_Contexts)           \
   V(WebSnapshotDeserialize_Exports)            \
   V(WebSnapshotDeserialize_Functions)          \
@@ -446,15 +446,22 @@ class MaglevCodeGeneratorImpl final {
 
   void EmitLazyDeopt(LazyDeoptInfo* deopt_info) {
     const MaglevCompilationUnit& unit = deopt_info->unit;
-    DCHECK_NULL(unit.caller());
-    DCHECK_EQ(unit.inlining_depth(), 0);
+    DCHECK_EQ(unit.inlining_depth() == 0, deopt_info->state.parent == nullptr);
 
-    int frame_count = 1;
-    int jsframe_count = 1;
+    int frame_count = 1 + unit.inlining_depth();
+    int jsframe_count = frame_count;
     int update_feedback_count = 0;
     deopt_info->translation_index = translation_array_builder_.BeginTranslation(
         frame_count, jsframe_count, update_feedback_count);
 
+    // Only the innermost frame receives the result of the lazily deopting
+    // call; the caller frames resume after their inlined calls.
+    const InputLocation* input_locations = deopt_info->input_locations;
+    if (deopt_info->state.parent) {
+      input_locations = EmitDeoptFrame(
+          *unit.caller(), *deopt_info->state.parent, input_locations);
+    }
+
     // Return offsets are counted from the end of the translation frame, which
     // is the array [parameters..., locals..., accumulator].
     int return_offset;
@@ -484,8 +491,7 @@ class MaglevCodeGeneratorImpl final {
         unit.register_count(), return_offset, return_count);
 
     EmitDeoptFrameValues(unit, deopt_info->state.register_frame,
-                         deopt_info->input_locations,
-                         deopt_info->result_location);
+                         input_locations, deopt_info->result_location);
   }
 
   void EmitDeoptStoreRegister(const compiler::AllocatedOperand& operand,
@@ -134,10 +134,16 @@ class UseMarkingProcessor {
   }
   void MarkCheckpointNodes(NodeBase* node, const LazyDeoptInfo* deopt_info,
                            const ProcessingState& state) {
+    int index = 0;
+    if (deopt_info->state.parent) {
+      MarkCheckpointNodes(node, *deopt_info->unit.caller(),
+                          deopt_info->state.parent,
+                          deopt_info->input_locations, state, index);
+    }
+
     const CompactInterpreterFrameState* register_frame =
         deopt_info->state.register_frame;
     int use_id = node->id();
-    int index = 0;
 
     register_frame->ForEachValue(
         deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
@@ -143,6 +143,10 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
   }
 
   size_t GetMaxConcurrency(size_t) const override {
+    size_t max_threads = FLAG_concurrent_maglev_max_threads;
+    if (max_threads > 0) {
+      return std::min(max_threads, incoming_queue()->size());
+    }
     return incoming_queue()->size();
   }
 
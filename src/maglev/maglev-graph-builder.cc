@@ -34,6 +34,7 @@ MaglevGraphBuilder::MaglevGraphBuilder(LocalIsolate* local_isolate,
       parent_(parent),
       graph_(graph),
       iterator_(bytecode().object()),
+      known_node_maps_(zone()),
       // Add an extra jump_target slot for the inline exit if needed.
       jump_targets_(zone()->NewArray<BasicBlockRef>(bytecode().length() +
                                                     (is_inline() ? 1 : 0))),
@@ -544,7 +545,7 @@ void MaglevGraphBuilder::VisitGetNamedProperty() {
           LoadHandler::Kind kind = LoadHandler::KindBits::decode(smi_handler);
           if (kind == LoadHandler::Kind::kField &&
               !LoadHandler::IsWasmStructBits::decode(smi_handler)) {
-            AddNewNode<CheckMaps>({object}, named_feedback.maps()[0]);
+            BuildMapCheck(object, named_feedback.maps()[0]);
 
             ValueNode* load_source;
             if (LoadHandler::IsInobjectBits::decode(smi_handler)) {
@@ -615,7 +616,7 @@ void MaglevGraphBuilder::VisitSetNamedProperty() {
           int smi_handler = handler->ToSmi().value();
           StoreHandler::Kind kind = StoreHandler::KindBits::decode(smi_handler);
           if (kind == StoreHandler::Kind::kField) {
-            AddNewNode<CheckMaps>({object}, named_feedback.maps()[0]);
+            BuildMapCheck(object, named_feedback.maps()[0]);
             ValueNode* value = GetAccumulatorTagged();
             AddNewNode<StoreField>({object, value}, smi_handler);
             return;
@@ -734,9 +735,38 @@ MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertyStrict)
 MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertySloppy)
 MAGLEV_UNIMPLEMENTED_BYTECODE(GetSuperConstructor)
 
+void MaglevGraphBuilder::BuildMapCheck(ValueNode* object,
+                                       const compiler::MapRef& map) {
+  auto it = known_node_maps_.find(object);
+  if (it != known_node_maps_.end() && it->second.equals(map)) return;
+  AddNewNode<CheckMaps>({object}, map);
+  known_node_maps_.erase(object);
+  known_node_maps_.emplace(object, map);
+}
+
+bool MaglevGraphBuilder::ShouldInlineCall(compiler::JSFunctionRef function,
+                                          float call_frequency) {
+  if (compilation_unit_->inlining_depth() >= FLAG_max_maglev_inline_depth) {
+    return false;
+  }
+  // Only inline call sites that are hot relative to the caller; an unknown
+  // frequency (NaN) fails this check as well.
+  if (!(call_frequency >= FLAG_min_maglev_inlining_frequency)) return false;
+  compiler::SharedFunctionInfoRef shared = function.shared();
+  if (!shared.IsInlineable()) return false;
+  return shared.GetBytecodeArray().length() <=
+         FLAG_max_maglev_inlined_bytecode_size;
+}
+
 void MaglevGraphBuilder::InlineCallFromRegisters(
     int argc_count, ConvertReceiverMode receiver_mode,
     compiler::JSFunctionRef function) {
+  // Deopts in the inlined function resume the caller after the call, so the
+  // caller's checkpoint has to be taken at the call itself rather than reused
+  // from an earlier bytecode.
+  MarkPossibleSideEffect();
+  AddNewNode<CheckValue>({LoadRegisterTagged(0)}, function);
+
   // The undefined constant node has to be created before the inner graph is
   // created.
   RootConstant* undefined_constant;
@@ -897,6 +927,7 @@ void MaglevGraphBuilder::BuildCallFromRegisters(
       if (!target.IsJSFunction()) break;
 
       compiler::JSFunctionRef function = target.AsJSFunction();
+      if (!ShouldInlineCall(function, call_feedback.frequency())) break;
       base::Optional<compiler::FeedbackVectorRef> maybe_feedback_vector =
           function.feedback_vector(broker()->dependencies());
       if (!maybe_feedback_vector.has_value()) break;
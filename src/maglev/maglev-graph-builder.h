@@ -19,6 +19,7 @@
 #include "src/maglev/maglev-graph.h"
 #include "src/maglev/maglev-ir.h"
 #include "src/utils/memcopy.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -451,8 +452,11 @@ class MaglevGraphBuilder {
         BytecodeOffset(iterator_.current_offset()),
         zone()->New<CompactInterpreterFrameState>(
             *compilation_unit_, GetOutLiveness(), current_interpreter_frame_),
-        // TODO(leszeks): Support lazy deopts in inlined functions.
-        nullptr);
+        // The caller frames resume after the inlined call, so they use the
+        // same state as eager deopts in the inlined function.
+        parent_ == nullptr ? nullptr
+                           : zone()->New<CheckpointedInterpreterState>(
+                                 parent_->GetLatestCheckpointedState()));
   }
 
   template <typename NodeT>
@@ -470,6 +474,8 @@ class MaglevGraphBuilder {
   void MarkPossibleSideEffect() {
     // If there was a potential side effect, invalidate the previous checkpoint.
     latest_checkpointed_state_.reset();
+    // Any side effect could also change the map of an object.
+    known_node_maps_.clear();
   }
 
   int next_offset() const {
@@ -486,6 +492,9 @@ class MaglevGraphBuilder {
     DCHECK_NULL(current_block_);
     current_block_ = zone()->New<BasicBlock>(merge_states_[offset]);
     block_offset_ = offset;
+    // Map knowledge is only tracked within a block, since it is not merged
+    // across predecessors.
+    known_node_maps_.clear();
   }
 
   template <typename ControlNodeT, typename... Args>
@@ -544,6 +553,14 @@ class MaglevGraphBuilder {
     return block;
   }
 
+  // Emits a map check of |object| against |map|, unless an earlier check in
+  // the current block already established the map and nothing since could have
+  // changed it.
+  void BuildMapCheck(ValueNode* object, const compiler::MapRef& map);
+
+  // Returns whether a monomorphic call to |function| is small and hot enough
+  // to be inlined.
+  bool ShouldInlineCall(compiler::JSFunctionRef function, float call_frequency);
   void InlineCallFromRegisters(int argc_count,
                                ConvertReceiverMode receiver_mode,
                                compiler::JSFunctionRef function);
@@ -679,6 +696,9 @@ class MaglevGraphBuilder {
   BasicBlock* current_block_ = nullptr;
   int block_offset_ = 0;
   base::Optional<CheckpointedInterpreterState> latest_checkpointed_state_;
+  // Maps established by CheckMaps in the current block, reset on possible side
+  // effects.
+  ZoneMap<ValueNode*, compiler::MapRef> known_node_maps_;
 
   BasicBlockRef* jump_targets_;
   MergePointInterpreterFrameState** merge_states_;
@@ -302,30 +302,58 @@ void MaglevPrintingVisitor::PreProcessBasicBlock(
 
 namespace {
 
-template <typename NodeT>
-void PrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
-                     NodeT* node, const ProcessingState& state) {
+// Prints one line per frame of {checkpoint}, starting with the outermost
+// caller, since that is the order in which the frame values appear in the
+// deopt input locations. Only the innermost frame has a result location.
+int PrintDeoptFrames(std::ostream& os, std::vector<BasicBlock*> targets,
+                     const ProcessingState& state, const char* label,
+                     const MaglevCompilationUnit& unit,
+                     const CheckpointedInterpreterState& checkpoint,
+                     const InputLocation* input_locations,
+                     interpreter::Register result_location, int index) {
   MaglevGraphLabeller* graph_labeller = state.graph_labeller();
 
+  if (checkpoint.parent) {
+    index = PrintDeoptFrames(os, targets, state, label, *unit.caller(),
+                             *checkpoint.parent, input_locations,
+                             interpreter::Register::invalid_value(), index);
+  }
+
   PrintVerticalArrows(os, targets);
   PrintPadding(os, graph_labeller, 0);
 
-  EagerDeoptInfo* deopt_info = node->eager_deopt_info();
-  os << "  ↱ eager @" << deopt_info->state.bytecode_position << " : {";
+  os << label << " @" << checkpoint.bytecode_position;
+  if (unit.inlining_depth() > 0) os << " (inlined)";
+  os << " : {";
   bool first = true;
-  int index = 0;
-  deopt_info->state.register_frame->ForEachValue(
-      deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
+  checkpoint.register_frame->ForEachValue(
+      unit, [&](ValueNode* node, interpreter::Register reg) {
         if (first) {
           first = false;
         } else {
           os << ", ";
         }
-        os << reg.ToString() << ":" << PrintNodeLabel(graph_labeller, node)
-           << ":" << deopt_info->input_locations[index].operand();
+        os << reg.ToString() << ":";
+        // The result location has no input location of its own.
+        if (reg == result_location) {
+          os << "<result>";
+          return;
+        }
+        os << PrintNodeLabel(graph_labeller, node) << ":"
+           << input_locations[index].operand();
         index++;
       });
   os << "}\n";
+  return index;
+}
+
+template <typename NodeT>
+void PrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
+                     NodeT* node, const ProcessingState& state) {
+  EagerDeoptInfo* deopt_info = node->eager_deopt_info();
+  PrintDeoptFrames(os, targets, state, "  ↱ eager", deopt_info->unit,
+                   deopt_info->state, deopt_info->input_locations,
+                   interpreter::Register::invalid_value(), 0);
 }
 void MaybePrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
                           NodeBase* node, const ProcessingState& state) {
@@ -344,32 +372,10 @@ void MaybePrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
 template <typename NodeT>
 void PrintLazyDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
                     NodeT* node, const ProcessingState& state) {
-  MaglevGraphLabeller* graph_labeller = state.graph_labeller();
-
-  PrintVerticalArrows(os, targets);
-  PrintPadding(os, graph_labeller, 0);
-
   LazyDeoptInfo* deopt_info = node->lazy_deopt_info();
-  os << "  ↳ lazy @" << deopt_info->state.bytecode_position << " : {";
-  bool first = true;
-  int index = 0;
-  deopt_info->state.register_frame->ForEachValue(
-      deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
-        if (first) {
-          first = false;
-        } else {
-          os << ", ";
-        }
-        os << reg.ToString() << ":";
-        if (reg == deopt_info->result_location) {
-          os << "<result>";
-        } else {
-          os << PrintNodeLabel(graph_labeller, node) << ":"
-             << deopt_info->input_locations[index].operand();
-        }
-        index++;
-      });
-  os << "}\n";
+  PrintDeoptFrames(os, targets, state, "  ↳ lazy", deopt_info->unit,
+                   deopt_info->state, deopt_info->input_locations,
+                   deopt_info->result_location, 0);
 }
 void MaybePrintLazyDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
                          NodeBase* node, const ProcessingState& state) {
@@ -88,6 +88,7 @@ class MaglevGraphVerifier {
       case Opcode::kLoadTaggedField:
       // TODO(victorgomes): Can we check that the input is actually a map?
       case Opcode::kCheckMaps:
+      case Opcode::kCheckValue:
       // TODO(victorgomes): Can we check that the input is Boolean?
       case Opcode::kBranchIfToBooleanTrue:
       case Opcode::kBranchIfTrue:
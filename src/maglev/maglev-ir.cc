@@ -679,6 +679,21 @@ void CheckMaps::PrintParams(std::ostream& os,
   os << "(" << *map().object() << ")";
 }
 
+void CheckValue::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                              const ProcessingState& state) {
+  UseRegister(target_input());
+}
+void CheckValue::GenerateCode(MaglevCodeGenState* code_gen_state,
+                              const ProcessingState& state) {
+  Register target = ToRegister(target_input());
+  __ Cmp(target, value().object());
+  EmitEagerDeoptIf(not_equal, code_gen_state, this);
+}
+void CheckValue::PrintParams(std::ostream& os,
+                             MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << *value().object() << ")";
+}
+
 void LoadTaggedField::AllocateVreg(MaglevVregAllocationState* vreg_state,
                                    const ProcessingState& state) {
   UseRegister(object_input());
@@ -739,6 +754,11 @@ void StoreField::GenerateCode(MaglevCodeGenState* code_gen_state,
     int offset =
         StoreHandler::FieldIndexBits::decode(this->handler()) * kTaggedSize;
     __ StoreTaggedField(FieldOperand(object, offset), value);
+    // Values that are statically known to be Smis never need a write barrier.
+    ValueNode* value_node = value_input().node();
+    if (value_node->Is<SmiConstant>() || value_node->Is<CheckedSmiTag>()) {
+      return;
+    }
     // TODO(leszeks): Add input clobbering to remove the need for this
     // unconditional value scratch register.
     Register value_scratch = temps.PopFirst();
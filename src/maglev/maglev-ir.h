@@ -102,6 +102,7 @@ class CompactInterpreterFrameState;
 
 #define NODE_LIST(V)    \
   V(CheckMaps)          \
+  V(CheckValue)         \
   V(StoreField)         \
   GAP_MOVE_NODE_LIST(V) \
   VALUE_NODE_LIST(V)
@@ -1417,6 +1418,29 @@ class CheckMaps : public FixedInputNodeT<1, CheckMaps> {
   const compiler::MapRef map_;
 };
 
+// Deopts unless the input is the given heap object.
+class CheckValue : public FixedInputNodeT<1, CheckValue> {
+  using Base = FixedInputNodeT<1, CheckValue>;
+
+ public:
+  explicit CheckValue(uint32_t bitfield, const compiler::HeapObjectRef& value)
+      : Base(bitfield), value_(value) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt();
+
+  compiler::HeapObjectRef value() const { return value_; }
+
+  static constexpr int kTargetIndex = 0;
+  Input& target_input() { return input(kTargetIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::HeapObjectRef value_;
+};
+
 class LoadTaggedField : public FixedInputValueNodeT<1, LoadTaggedField> {
   using Base = FixedInputValueNodeT<1, LoadTaggedField>;
 
@@ -285,8 +285,10 @@ void StraightForwardRegisterAllocator::AllocateRegisters(Graph* graph) {
       // Secondly try to assign the phi to a free register.
       for (Phi* phi : *block->phis()) {
         if (phi->result().operand().IsAllocated()) continue;
-        // We assume that Phis are always untagged, and so are always allocated
+        // We assume that Phis are always tagged, and so are always allocated
         // in a general register.
+        DCHECK_EQ(phi->properties().value_representation(),
+                  ValueRepresentation::kTagged);
         compiler::InstructionOperand allocation =
             general_registers_.TryAllocateRegister(phi);
         if (allocation.IsAllocated()) {
@@ -378,9 +380,13 @@ void StraightForwardRegisterAllocator::UpdateUse(
 
 void StraightForwardRegisterAllocator::UpdateUse(
     const LazyDeoptInfo& deopt_info) {
+  int index = 0;
+  if (deopt_info.state.parent) {
+    UpdateUse(*deopt_info.unit.caller(), deopt_info.state.parent,
+              deopt_info.input_locations, index);
+  }
   const CompactInterpreterFrameState* checkpoint_state =
       deopt_info.state.register_frame;
-  int index = 0;
   checkpoint_state->ForEachValue(
       deopt_info.unit, [&](ValueNode* node, interpreter::Register reg) {
         // Skip over the result location.
@@ -287,7 +287,12 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     Isolate* isolate, size_t byte_length, SharedFlag shared,
     InitializedFlag initialized) {
   void* buffer_start = nullptr;
-  auto allocator = isolate->array_buffer_allocator();
+  // Unshared backing stores are short-lived more often than not, so they are
+  // served from the isolate's pool if there is one.
+  std::shared_ptr<PoolingArrayBufferAllocator> pool;
+  if (shared == SharedFlag::kNotShared) pool = isolate->array_buffer_pool();
+  v8::ArrayBuffer::Allocator* allocator =
+      pool ? pool.get() : isolate->array_buffer_allocator();
   CHECK_NOT_NULL(allocator);
   if (byte_length != 0) {
     auto counters = isolate->counters();
@@ -340,22 +345,31 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
 
   TRACE_BS("BS:alloc  bs=%p mem=%p (length=%zu)\n", result,
            result->buffer_start(), byte_length);
-  result->SetAllocatorFromIsolate(isolate);
+  if (pool) {
+    result->SetAllocator(std::move(pool));
+  } else {
+    result->SetAllocatorFromIsolate(isolate);
+  }
   return std::unique_ptr<BackingStore>(result);
 }
 
 void BackingStore::SetAllocatorFromIsolate(Isolate* isolate) {
   if (auto allocator_shared = isolate->array_buffer_allocator_shared()) {
-    holds_shared_ptr_to_allocator_ = true;
-    new (&type_specific_data_.v8_api_array_buffer_allocator_shared)
-        std::shared_ptr<v8::ArrayBuffer::Allocator>(
-            std::move(allocator_shared));
+    SetAllocator(std::move(allocator_shared));
   } else {
     type_specific_data_.v8_api_array_buffer_allocator =
         isolate->array_buffer_allocator();
   }
 }
 
+void BackingStore::SetAllocator(
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator) {
+  DCHECK(!holds_shared_ptr_to_allocator_);
+  holds_shared_ptr_to_allocator_ = true;
+  new (&type_specific_data_.v8_api_array_buffer_allocator_shared)
+      std::shared_ptr<v8::ArrayBuffer::Allocator>(std::move(allocator));
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 // Allocate a backing store for a Wasm memory. Always use the page allocator
 // and add guard regions.
@@ -810,7 +824,8 @@ bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
   CHECK(!is_wasm_memory_ && !custom_deleter_ && !globally_registered_ &&
         free_on_destruct_ && !is_resizable_);
   auto allocator = get_v8_api_array_buffer_allocator();
-  CHECK_EQ(isolate->array_buffer_allocator(), allocator);
+  CHECK(allocator == isolate->array_buffer_allocator() ||
+        allocator == isolate->array_buffer_pool().get());
   CHECK_EQ(byte_length_, byte_capacity_);
   void* new_start =
       allocator->Reallocate(buffer_start_, byte_length_, new_byte_length);
@@ -839,6 +854,90 @@ SharedWasmMemoryData* BackingStore::get_shared_wasm_memory_data() {
   return shared_wasm_memory_data;
 }
 
+PoolingArrayBufferAllocator::PoolingArrayBufferAllocator(
+    v8::ArrayBuffer::Allocator* allocator,
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared,
+    size_t max_pooled_bytes)
+    : allocator_(allocator),
+      allocator_shared_(std::move(allocator_shared)),
+      max_pooled_bytes_(max_pooled_bytes) {
+  CHECK_NOT_NULL(allocator_);
+  DCHECK_IMPLIES(allocator_shared_, allocator_shared_.get() == allocator_);
+  static_assert(kMinPooledLength << (kNumberOfSizeClasses - 1) ==
+                kMaxPooledLength);
+}
+
+PoolingArrayBufferAllocator::~PoolingArrayBufferAllocator() {
+  ReleasePooledMemory();
+}
+
+// static
+int PoolingArrayBufferAllocator::SizeClassFor(size_t length) {
+  if (length < kMinPooledLength || length > kMaxPooledLength) return -1;
+  int size_class = 0;
+  while (SizeOfClass(size_class) < length) size_class++;
+  DCHECK_LT(size_class, kNumberOfSizeClasses);
+  return size_class;
+}
+
+void* PoolingArrayBufferAllocator::TakeFromPool(int size_class) {
+  base::MutexGuard guard(&mutex_);
+  std::vector<void*>& free_list = free_lists_[size_class];
+  if (free_list.empty()) return nullptr;
+  void* data = free_list.back();
+  free_list.pop_back();
+  pooled_bytes_.fetch_sub(SizeOfClass(size_class), std::memory_order_relaxed);
+  pool_hits_.fetch_add(1, std::memory_order_relaxed);
+  return data;
+}
+
+void* PoolingArrayBufferAllocator::Allocate(size_t length) {
+  int size_class = SizeClassFor(length);
+  if (size_class < 0) return allocator_->Allocate(length);
+  if (void* data = TakeFromPool(size_class)) {
+    memset(data, 0, length);
+    return data;
+  }
+  return allocator_->Allocate(SizeOfClass(size_class));
+}
+
+void* PoolingArrayBufferAllocator::AllocateUninitialized(size_t length) {
+  int size_class = SizeClassFor(length);
+  if (size_class < 0) return allocator_->AllocateUninitialized(length);
+  if (void* data = TakeFromPool(size_class)) return data;
+  return allocator_->AllocateUninitialized(SizeOfClass(size_class));
+}
+
+void PoolingArrayBufferAllocator::Free(void* data, size_t length) {
+  int size_class = SizeClassFor(length);
+  if (size_class < 0) {
+    allocator_->Free(data, length);
+    return;
+  }
+  const size_t size = SizeOfClass(size_class);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (pooled_bytes_.load(std::memory_order_relaxed) + size <=
+        max_pooled_bytes_) {
+      free_lists_[size_class].push_back(data);
+      pooled_bytes_.fetch_add(size, std::memory_order_relaxed);
+      return;
+    }
+  }
+  allocator_->Free(data, size);
+}
+
+void PoolingArrayBufferAllocator::ReleasePooledMemory() {
+  base::MutexGuard guard(&mutex_);
+  for (int size_class = 0; size_class < kNumberOfSizeClasses; size_class++) {
+    for (void* data : free_lists_[size_class]) {
+      allocator_->Free(data, SizeOfClass(size_class));
+    }
+    free_lists_[size_class].clear();
+  }
+  pooled_bytes_.store(0, std::memory_order_relaxed);
+}
+
 namespace {
 // Implementation details of GlobalBackingStoreRegistry.
 struct GlobalBackingStoreRegistryImpl {
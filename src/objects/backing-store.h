@@ -5,11 +5,15 @@
 #ifndef V8_OBJECTS_BACKING_STORE_H_
 #define V8_OBJECTS_BACKING_STORE_H_
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "include/v8-array-buffer.h"
 #include "include/v8-internal.h"
 #include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
 #include "src/handles/handles.h"
 
 namespace v8 {
@@ -175,6 +179,7 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   BackingStore(const BackingStore&) = delete;
   BackingStore& operator=(const BackingStore&) = delete;
   void SetAllocatorFromIsolate(Isolate* isolate);
+  void SetAllocator(std::shared_ptr<v8::ArrayBuffer::Allocator> allocator);
 
   void* buffer_start_ = nullptr;
   std::atomic<size_t> byte_length_;
@@ -238,6 +243,68 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
 #endif  // V8_ENABLE_WEBASSEMBLY
 };
 
+// An array buffer allocator that keeps recently freed backing stores of a few
+// small size classes around for reuse instead of returning them to the
+// embedder's allocator right away. Short-lived typed arrays that are freed by
+// the ArrayBufferSweeper are thus recycled by later allocations of the same
+// size class. Lengths in [kMinPooledLength, kMaxPooledLength] are rounded up
+// to the next power of two; all other lengths are forwarded unchanged to the
+// underlying allocator. The amount of memory held by the pool is capped by
+// {max_pooled_bytes}.
+class V8_EXPORT_PRIVATE PoolingArrayBufferAllocator final
+    : public v8::ArrayBuffer::Allocator {
+ public:
+  static constexpr size_t kMinPooledLength = 4 * KB;
+  static constexpr size_t kMaxPooledLength = 64 * KB;
+  static constexpr int kNumberOfSizeClasses = 5;
+
+  PoolingArrayBufferAllocator(
+      v8::ArrayBuffer::Allocator* allocator,
+      std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared,
+      size_t max_pooled_bytes);
+  ~PoolingArrayBufferAllocator() override;
+  PoolingArrayBufferAllocator(const PoolingArrayBufferAllocator&) = delete;
+  PoolingArrayBufferAllocator& operator=(const PoolingArrayBufferAllocator&) =
+      delete;
+
+  void* Allocate(size_t length) override;
+  void* AllocateUninitialized(size_t length) override;
+  void Free(void* data, size_t length) override;
+
+  // Returns all pooled memory to the underlying allocator.
+  void ReleasePooledMemory();
+
+  // Number of bytes currently held by the pool.
+  size_t pooled_bytes() const {
+    return pooled_bytes_.load(std::memory_order_relaxed);
+  }
+  // Number of allocations that were served from the pool.
+  size_t pool_hits() const {
+    return pool_hits_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Returns the size class for {length}, or -1 if {length} is not pooled.
+  static int SizeClassFor(size_t length);
+  static size_t SizeOfClass(int size_class) {
+    return kMinPooledLength << size_class;
+  }
+
+  // Pops a pooled block of the given size class, or returns nullptr.
+  void* TakeFromPool(int size_class);
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  // Keeps the underlying allocator alive if the embedder provided it through
+  // Isolate::CreateParams::array_buffer_allocator_shared.
+  const std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared_;
+  const size_t max_pooled_bytes_;
+
+  base::Mutex mutex_;
+  std::vector<void*> free_lists_[kNumberOfSizeClasses];
+  std::atomic<size_t> pooled_bytes_{0};
+  std::atomic<size_t> pool_hits_{0};
+};
+
 // A global, per-process mapping from buffer addresses to backing stores
 // of wasm memory objects.
 class GlobalBackingStoreRegistry {
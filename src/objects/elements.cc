@@ -3326,6 +3326,36 @@ class TypedElementsAccessor
     return MaybeHandle<Object>(typed_array);
   }
 
+  // Returns the index of the first element in [start, end) that is equal to
+  // {value}, or {end} if there is none. For unshared buffers the element
+  // loads do not need to be atomic, which lets the compiler vectorize the
+  // search loop; single-byte elements are searched with memchr.
+  static size_t FindElement(ElementType* data_ptr, ElementType value,
+                            size_t start, size_t end,
+                            IsSharedBuffer is_shared) {
+    if (start >= end) return end;
+    if (is_shared == kUnshared) {
+      if (sizeof(ElementType) == 1) {
+        uint8_t byte;
+        memcpy(&byte, &value, 1);
+        const void* match = memchr(data_ptr + start, byte, end - start);
+        if (match == nullptr) return end;
+        return static_cast<const ElementType*>(match) - data_ptr;
+      }
+      for (size_t k = start; k < end; ++k) {
+        ElementType elem_k = base::ReadUnalignedValue<ElementType>(
+            reinterpret_cast<Address>(data_ptr + k));
+        if (elem_k == value) return k;
+      }
+      return end;
+    }
+    for (size_t k = start; k < end; ++k) {
+      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, kShared);
+      if (elem_k == value) return k;
+    }
+    return end;
+  }
+
   static Maybe<bool> IncludesValueImpl(Isolate* isolate,
                                        Handle<JSObject> receiver,
                                        Handle<Object> value, size_t start_from,
@@ -3393,11 +3423,8 @@ class TypedElementsAccessor
       }
     }
 
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just(true);
-    }
-    return Just(false);
+    return Just(FindElement(data_ptr, typed_search_value, start_from, length,
+                            is_shared) < length);
   }
 
   static Maybe<int64_t> IndexOfValueImpl(Isolate* isolate,
@@ -3457,10 +3484,9 @@ class TypedElementsAccessor
     }
 
     auto is_shared = typed_array.buffer().is_shared() ? kShared : kUnshared;
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just<int64_t>(k);
-    }
+    size_t k = FindElement(data_ptr, typed_search_value, start_from, length,
+                           is_shared);
+    if (k < length) return Just<int64_t>(k);
     return Just<int64_t>(-1);
   }
 
@@ -141,6 +141,26 @@ void FeedbackVector::RequestOsrAtNextOpportunity() {
 
 void FeedbackVector::reset_osr_state() { set_osr_state(0); }
 
+bool FeedbackVector::expensive_turbofan_compile() const {
+  return ExpensiveTurbofanCompileBit::decode(tiering_backoff());
+}
+
+void FeedbackVector::set_expensive_turbofan_compile(bool value) {
+  set_tiering_backoff(
+      ExpensiveTurbofanCompileBit::update(tiering_backoff(), value));
+}
+
+int FeedbackVector::turbofan_deopt_count() const {
+  return TurbofanDeoptCountBits::decode(tiering_backoff());
+}
+
+void FeedbackVector::SaturatingIncrementTurbofanDeoptCount() {
+  int count = turbofan_deopt_count();
+  if (count == kMaxTurbofanDeoptCount) return;
+  set_tiering_backoff(
+      TurbofanDeoptCountBits::update(tiering_backoff(), count + 1));
+}
+
 bool FeedbackVector::maybe_has_optimized_osr_code() const {
   return MaybeHasOptimizedOsrCodeBit::decode(osr_state());
 }
@@ -198,6 +198,7 @@ class FeedbackVector
  public:
   NEVER_READ_ONLY_SPACE
   DEFINE_TORQUE_GENERATED_OSR_STATE()
+  DEFINE_TORQUE_GENERATED_TIERING_BACKOFF()
   DEFINE_TORQUE_GENERATED_FEEDBACK_VECTOR_FLAGS()
   static_assert(TieringState::kLastTieringState <= TieringStateBits::kMax);
 
@@ -246,6 +247,15 @@ class FeedbackVector
   // The `osr_state` contains the osr_urgency and maybe_has_optimized_osr_code.
   inline void reset_osr_state();
 
+  // Compile cost and deopt history, used by the TieringManager to back off
+  // from re-optimizing functions that are expensive to compile with Turbofan
+  // and keep deoptimizing.
+  static constexpr int kMaxTurbofanDeoptCount = TurbofanDeoptCountBits::kMax;
+  inline bool expensive_turbofan_compile() const;
+  inline void set_expensive_turbofan_compile(bool value);
+  inline int turbofan_deopt_count() const;
+  inline void SaturatingIncrementTurbofanDeoptCount();
+
   inline CodeT optimized_code() const;
   // Whether maybe_optimized_code contains a cached Code object.
   inline bool has_optimized_code() const;
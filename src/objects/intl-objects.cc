@@ -157,6 +157,87 @@ void ToUpperWithSharpS(const base::Vector<const Char>& src,
   }
 }
 
+// Maps a single BMP character in the root locale if its mapping is a simple
+// one-to-one mapping that does not depend on context: Latin-1, basic Cyrillic
+// and scripts without case (kana, CJK ideographs, Hangul syllables). Returns
+// false for any other character.
+template <bool is_lower>
+inline bool ConvertCaseSimpleTwoByte(uint16_t ch, uint16_t* out) {
+  if (ch <= 0xFF) {
+    if (is_lower) {
+      *out = ToLatin1Lower(ch);
+      return true;
+    }
+    if (V8_UNLIKELY(ch == sharp_s || ch == 0xB5 || ch == 0xFF)) return false;
+    *out = ToLatin1Upper(ch);
+    return true;
+  }
+  if (ch >= 0x400 && ch <= 0x45F) {
+    if (is_lower) {
+      *out = static_cast<uint16_t>(ch < 0x410   ? ch + 0x50
+                                   : ch < 0x430 ? ch + 0x20
+                                                : ch);
+    } else {
+      *out = static_cast<uint16_t>(ch >= 0x450   ? ch - 0x50
+                                   : ch >= 0x430 ? ch - 0x20
+                                                 : ch);
+    }
+    return true;
+  }
+  if ((ch >= 0x3040 && ch <= 0x9FFF) || (ch >= 0xAC00 && ch <= 0xD7A3)) {
+    *out = ch;
+    return true;
+  }
+  return false;
+}
+
+// Case-converts a flat two-byte string without calling into ICU when all of
+// its characters have simple mappings. Returns false if the full Unicode path
+// is needed.
+template <bool is_lower>
+bool TryConvertCaseTwoByte(Isolate* isolate, Handle<String> s,
+                           Handle<String>* result) {
+  DCHECK(s->IsFlat());
+  DCHECK(!s->IsOneByteRepresentation());
+  const int length = s->length();
+
+  // Check that every character has a simple mapping before allocating the
+  // result, and find the first one that changes.
+  int first_changed = length;
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent flat = s->GetFlatContent(no_gc);
+    DCHECK(flat.IsTwoByte());
+    const uint16_t* src_data = flat.ToUC16Vector().begin();
+    for (int index = 0; index < length; ++index) {
+      const uint16_t ch = src_data[index];
+      uint16_t converted;
+      if (!ConvertCaseSimpleTwoByte<is_lower>(ch, &converted)) return false;
+      if (converted != ch && first_changed == length) first_changed = index;
+    }
+  }
+  if (first_changed == length) {
+    *result = s;
+    return true;
+  }
+
+  Handle<SeqTwoByteString> dst =
+      isolate->factory()->NewRawTwoByteString(length).ToHandleChecked();
+  DisallowGarbageCollection no_gc;
+  String::FlatContent flat = s->GetFlatContent(no_gc);
+  const uint16_t* src_data = flat.ToUC16Vector().begin();
+  uint16_t* dst_data = dst->GetChars(no_gc);
+  CopyChars(dst_data, src_data, first_changed);
+  for (int index = first_changed; index < length; ++index) {
+    bool converted =
+        ConvertCaseSimpleTwoByte<is_lower>(src_data[index], &dst_data[index]);
+    DCHECK(converted);
+    USE(converted);
+  }
+  *result = dst;
+  return true;
+}
+
 inline int FindFirstUpperOrNonAscii(String s, int length) {
   for (int index = 0; index < length; ++index) {
     uint16_t ch = s.Get(index);
@@ -335,6 +416,8 @@ String Intl::ConvertOneByteToLower(String src, String dst) {
 
 MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate, Handle<String> s) {
   if (!s->IsOneByteRepresentation()) {
+    Handle<String> result;
+    if (TryConvertCaseTwoByte<true>(isolate, s, &result)) return result;
     // Use a slower implementation for strings with characters beyond U+00FF.
     return LocaleConvertCase(isolate, s, false, "");
   }
@@ -425,6 +508,12 @@ MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
     return result;
   }
 
+  if (!s->IsOneByteRepresentation()) {
+    DCHECK(s->IsFlat());
+    Handle<String> result;
+    if (TryConvertCaseTwoByte<false>(isolate, s, &result)) return result;
+  }
+
   return LocaleConvertCase(isolate, s, true, "");
 }
 
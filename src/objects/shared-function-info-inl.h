@@ -264,6 +264,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
                     SharedFunctionInfo::MaglevCompilationFailedBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, was_marked_for_turbofan,
+                    SharedFunctionInfo::WasMarkedForTurbofanBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -640,6 +643,9 @@ bool SharedFunctionInfo::ShouldFlushCode(
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
+  if (IsEagerFlushingEnabled(code_flush_mode)) {
+    return bytecode.bytecode_age() > BytecodeArray::kNoAgeBytecodeAge;
+  }
   return bytecode.IsOld();
 }
 
@@ -449,6 +449,11 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(maglev_compilation_failed)
 
+  // True if the tiering manager has marked a closure of this function for
+  // Turbofan. Only recorded with --code-cache-tiering-hints; the bit is
+  // serialized with the code cache and shortens tier-up after a restart.
+  DECL_BOOLEAN_ACCESSORS(was_marked_for_turbofan)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -1086,28 +1086,37 @@ void StringForwardingTable::IterateElements(RootVisitor* visitor) {
   if (next_free_index_ == 0) return;  // Early exit if table is empty.
 
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  const uint32_t last_block = static_cast<uint32_t>(blocks->size() - 1);
+  // Blocks are retained across Reset(), so the last used block isn't
+  // necessarily the last block in the vector.
+  uint32_t last_index_in_block;
+  const uint32_t last_block =
+      BlockForIndex(next_free_index_ - 1, &last_index_in_block);
+  DCHECK_LT(last_block, blocks->size());
   for (uint32_t block = 0; block < last_block; ++block) {
     Block* data = blocks->LoadBlock(block);
     data->IterateElements(visitor, data->capacity());
   }
   // Handle last block separately, as it is not filled to capacity.
-  const uint32_t max_index = IndexInBlock(next_free_index_ - 1, last_block) + 1;
   Block* data = blocks->LoadBlock(last_block);
-  data->IterateElements(visitor, max_index);
+  data->IterateElements(visitor, last_index_in_block + 1);
 }
 
 void StringForwardingTable::Reset() {
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
 
+  // Keep the blocks allocated in this cycle around, so that the next cycle
+  // doesn't have to grow the table (under |grow_mutex_|) again from the
+  // initial block. Entries at or above |next_free_index_| are never read, so
+  // the stale contents don't need to be cleared. Old BlockVectors only had to
+  // be kept alive for concurrent readers, which can't exist during a
+  // safepoint.
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  for (uint32_t block = 0; block < blocks->size(); ++block) {
-    delete blocks->LoadBlock(block);
-  }
-
+  DCHECK_EQ(blocks, block_vector_storage_.back().get());
+  std::unique_ptr<BlockVector> current =
+      std::move(block_vector_storage_.back());
   block_vector_storage_.clear();
-  InitializeBlockVector();
+  block_vector_storage_.push_back(std::move(current));
   next_free_index_ = 0;
 }
 
@@ -1117,15 +1126,17 @@ void StringForwardingTable::UpdateAfterEvacuation() {
   if (next_free_index_ == 0) return;  // Early exit if table is empty.
 
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  const unsigned int last_block = static_cast<unsigned int>(blocks->size() - 1);
-  for (unsigned int block = 0; block < last_block; ++block) {
+  uint32_t last_index_in_block;
+  const uint32_t last_block =
+      BlockForIndex(next_free_index_ - 1, &last_index_in_block);
+  DCHECK_LT(last_block, blocks->size());
+  for (uint32_t block = 0; block < last_block; ++block) {
     Block* data = blocks->LoadBlock(block, kAcquireLoad);
     data->UpdateAfterEvacuation(isolate_);
   }
   // Handle last block separately, as it is not filled to capacity.
-  const int max_index = IndexInBlock(next_free_index_ - 1, last_block) + 1;
   blocks->LoadBlock(last_block, kAcquireLoad)
-      ->UpdateAfterEvacuation(isolate_, max_index);
+      ->UpdateAfterEvacuation(isolate_, last_index_in_block + 1);
 }
 
 }  // namespace internal
@@ -978,6 +978,19 @@ bool String::SlowEquals(Isolate* isolate, Handle<String> one,
   // before we try to flatten the strings.
   if (one->Get(0) != two->Get(0)) return false;
 
+  // Flattening a long rope copies all of its characters, which is wasted
+  // work if the string is only compared once. Walk such ropes leaf by leaf
+  // instead; short ropes are still flattened since later operations on them
+  // benefit from the flat representation.
+  static const int kMinLengthForRopeCompare = 4 * KB;
+  if (one_length >= kMinLengthForRopeCompare &&
+      (!one->IsFlat() || !two->IsFlat())) {
+    DisallowGarbageCollection no_gc;
+    StringComparator comparator;
+    return comparator.Equals(*one, *two,
+                             SharedStringAccessGuardIfNeeded(isolate));
+  }
+
   one = String::Flatten(isolate, one);
   two = String::Flatten(isolate, two);
 
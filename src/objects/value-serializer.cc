@@ -709,11 +709,21 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
         // Elements are empty_fixed_array, not a FixedDoubleArray, if the array
         // is empty. No elements to encode in this case anyhow.
         if (length == 0) break;
+        // Reserve the space for all elements at once; each one is written as
+        // a tag followed by the raw double.
+        constexpr size_t kElementSize = 1 + sizeof(double);
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * kElementSize).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
         DisallowGarbageCollection no_gc;
         FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
         for (i = 0; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements.get_scalar(i));
+          *dest++ = static_cast<uint8_t>(SerializationTag::kDouble);
+          // Warning: this uses host endianness, like WriteDouble.
+          double value = elements.get_scalar(i);
+          memcpy(dest, &value, sizeof(value));
+          dest += sizeof(value);
         }
         break;
       }
@@ -1720,11 +1730,30 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   auto elements_length = static_cast<uint32_t>(elements->length());
   for (uint32_t i = 0; i < length; i++) {
     SerializationTag tag;
-    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+    bool has_tag = PeekTag().To(&tag);
+    if (has_tag && tag == SerializationTag::kTheHole) {
       ConsumeTag(SerializationTag::kTheHole);
       continue;
     }
 
+    // Fast path for Smis, which are the bulk of numeric arrays. This avoids
+    // the recursion through ReadObject and a handle per element.
+    if (has_tag && tag == SerializationTag::kInt32) {
+      ConsumeTag(SerializationTag::kInt32);
+      int32_t value;
+      if (!ReadZigZag<int32_t>().To(&value)) return MaybeHandle<JSArray>();
+      // Safety check.
+      if (i >= elements_length) return MaybeHandle<JSArray>();
+      if (Smi::IsValid(value)) {
+        elements->set(i, Smi::FromInt(value));
+      } else {
+        // Allocate before dereferencing {elements}, as this may cause a GC.
+        Handle<Object> number = isolate_->factory()->NewNumberFromInt(value);
+        elements->set(i, *number);
+      }
+      continue;
+    }
+
     Handle<Object> element;
     if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
 
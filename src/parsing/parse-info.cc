@@ -39,6 +39,8 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
                                isolate->NeedsDetailedOptimizedCodeLineInfo());
   set_post_parallel_compile_tasks_for_eager_toplevel(
       FLAG_parallel_compile_tasks_for_eager_toplevel);
+  set_post_parallel_compile_tasks_for_eager_inner(
+      FLAG_parallel_compile_tasks_for_eager_inner);
   set_post_parallel_compile_tasks_for_lazy(
       FLAG_parallel_compile_tasks_for_lazy);
 }
@@ -2687,6 +2687,7 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
   const bool is_top_level = AllowsLazyParsingWithoutUnresolvedVariables();
   const bool is_eager_top_level_function = !is_lazy && is_top_level;
+  const bool is_eager_inner_function = !is_lazy && !is_top_level;
 
   RCS_SCOPE(runtime_call_stats_, RuntimeCallCounterId::kParseFunctionLiteral,
             RuntimeCallStats::kThreadSpecific);
@@ -2711,6 +2712,8 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       can_post_parallel_task &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
+       (is_eager_inner_function &&
+        flags().post_parallel_compile_tasks_for_eager_inner()) ||
        (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
 
   // Determine whether we should lazy parse the inner function. This will be
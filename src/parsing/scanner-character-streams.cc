@@ -9,6 +9,7 @@
 
 #include "include/v8-callbacks.h"
 #include "include/v8-primitive.h"
+#include "src/base/build_config.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate-utils.h"
@@ -16,8 +17,13 @@
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/scanner.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -636,6 +642,33 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   return current_.pos.chars == position;
 }
 
+namespace {
+
+// Copies the longest ASCII prefix of |src| (at most |length| bytes) to |dst|,
+// widening it to UTF-16, and returns its length. Validation and widening are
+// done in a single pass over the input where SIMD is available.
+int CopyAsciiPrefix(uint16_t* dst, const uint8_t* src, int length) {
+  int copied = 0;
+#if V8_HOST_HAS_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  while (copied + static_cast<int>(sizeof(__m128i)) <= length) {
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + copied));
+    if (_mm_movemask_epi8(bytes) != 0) break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + copied),
+                     _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + copied + 8),
+                     _mm_unpackhi_epi8(bytes, zero));
+    copied += sizeof(__m128i);
+  }
+#endif
+  int ascii_length = NonAsciiStart(src + copied, length - copied);
+  CopyChars(dst + copied, src + copied, ascii_length);
+  return copied + ascii_length;
+}
+
+}  // namespace
+
 void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   DCHECK_LT(current_.chunk_no, chunks_->size());
   DCHECK_EQ(buffer_start_, buffer_cursor_);
@@ -710,8 +743,7 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     size_t max_buffer = max_buffer_end - output_cursor;
     int max_length = static_cast<int>(std::min(remaining, max_buffer));
     DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
-    int ascii_length = NonAsciiStart(cursor, max_length);
-    CopyChars(output_cursor, cursor, ascii_length);
+    int ascii_length = CopyAsciiPrefix(output_cursor, cursor, max_length);
     cursor += ascii_length;
     output_cursor += ascii_length;
   }
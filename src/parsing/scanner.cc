@@ -11,6 +11,8 @@
 #include <cmath>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/base/platform/wrappers.h"
 #include "src/base/strings.h"
 #include "src/numbers/conversions-inl.h"
@@ -19,6 +21,10 @@
 #include "src/parsing/scanner-inl.h"
 #include "src/zone/zone.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -205,13 +211,63 @@ Token::Value Scanner::SkipSingleHTMLComment() {
   return SkipSingleLineComment();
 }
 
+namespace {
+
+// Vectorized search helpers for the comment skipping loops, which on minified
+// code with license headers or source maps can cover long runs of input. They
+// return the first position in [cursor, end) that matches, or end.
+
+const uint16_t* FindLineTerminator(const uint16_t* cursor,
+                                   const uint16_t* end) {
+#if V8_HOST_HAS_SSE2
+  const __m128i lf = _mm_set1_epi16(0x000A);
+  const __m128i cr = _mm_set1_epi16(0x000D);
+  // LS (U+2028) and PS (U+2029) only differ in the lowest bit.
+  const __m128i ls_ps_mask = _mm_set1_epi16(static_cast<int16_t>(0xFFFE));
+  const __m128i ls_ps = _mm_set1_epi16(0x2028);
+  while (end - cursor >= 8) {
+    __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, lf), _mm_cmpeq_epi16(chars, cr)),
+        _mm_cmpeq_epi16(_mm_and_si128(chars, ls_ps_mask), ls_ps));
+    int mask = _mm_movemask_epi8(matches);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros32(mask) / 2;
+    }
+    cursor += 8;
+  }
+#endif
+  return std::find_if(cursor, end, [](uint16_t c) {
+    return unibrow::IsLineTerminator(static_cast<base::uc32>(c));
+  });
+}
+
+const uint16_t* FindAsterisk(const uint16_t* cursor, const uint16_t* end) {
+#if V8_HOST_HAS_SSE2
+  const __m128i asterisk = _mm_set1_epi16('*');
+  while (end - cursor >= 8) {
+    __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chars, asterisk));
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros32(mask) / 2;
+    }
+    cursor += 8;
+  }
+#endif
+  return std::find(cursor, end, static_cast<uint16_t>('*'));
+}
+
+}  // namespace
+
 Token::Value Scanner::SkipSingleLineComment() {
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntilFound(FindLineTerminator);
 
   return Token::WHITESPACE;
 }
@@ -303,7 +359,7 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilFound(FindAsterisk);
 
     while (c0_ == '*') {
       Advance();
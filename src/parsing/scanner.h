@@ -73,12 +73,22 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE base::uc32 AdvanceUntil(FunctionType check) {
-    while (true) {
-      auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+    return AdvanceUntilFound(
+        [&check](const uint16_t* start, const uint16_t* end) {
+          return std::find_if(start, end, [&check](uint16_t raw_c0_) {
             base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
             return check(c0_);
           });
+        });
+  }
+
+  // Like AdvanceUntil, but |find| searches a whole range of the buffer at a
+  // time and returns the position of the first matching code unit (or |end|).
+  // This allows for vectorized search loops.
+  template <typename FinderType>
+  V8_INLINE base::uc32 AdvanceUntilFound(FinderType find) {
+    while (true) {
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
 
       if (next_cursor_pos == buffer_end_) {
         buffer_cursor_ = buffer_end_;
@@ -537,6 +547,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FinderType>
+  V8_INLINE void AdvanceUntilFound(FinderType find) {
+    c0_ = source_->AdvanceUntilFound(find);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
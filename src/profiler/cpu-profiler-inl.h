@@ -62,7 +62,10 @@ void ReportBuiltinEventRecord::UpdateCodeMap(CodeMap* code_map) {
 
 TickSample* SamplingEventsProcessor::StartTickSample() {
   void* address = ticks_buffer_.StartEnqueue();
-  if (address == nullptr) return nullptr;
+  if (address == nullptr) {
+    dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
   TickSampleEventRecord* evt =
       new (address) TickSampleEventRecord(last_code_event_id_);
   return &evt->sample;
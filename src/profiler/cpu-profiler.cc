@@ -241,6 +241,11 @@ void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
       reinterpret_cast<Address>(tick_sample.embedder_context));
 }
 
+void SamplingEventsProcessor::ReportDroppedSamples() {
+  unsigned dropped = dropped_samples_.exchange(0, std::memory_order_relaxed);
+  if (dropped > 0) profiles_->AddDroppedSamplesToCurrentProfiles(dropped);
+}
+
 ProfilerEventsProcessor::SampleProcessingResult
 SamplingEventsProcessor::ProcessOneSample() {
   TickSampleEventRecord record1;
@@ -282,6 +287,7 @@ void SamplingEventsProcessor::Run() {
       }
       now = base::TimeTicks::Now();
     } while (result != NoSamplesInQueue && now < nextSampleTime);
+    ReportDroppedSamples();
 
     if (nextSampleTime > now) {
 #if V8_OS_WIN
@@ -322,6 +328,7 @@ void SamplingEventsProcessor::Run() {
       result = ProcessOneSample();
     } while (result == OneSampleProcessed);
   } while (ProcessCodeEvent());
+  ReportDroppedSamples();
 }
 
 void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
@@ -244,6 +244,9 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
  private:
   SampleProcessingResult ProcessOneSample() override;
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
+  // Attributes the samples dropped since the last call to the profiles that
+  // are currently being recorded.
+  void ReportDroppedSamples();
 
   static const size_t kTickSampleBufferSize = 512 * KB;
   static const size_t kTickSampleQueueLength =
@@ -251,6 +254,9 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   SamplingCircularQueue<TickSampleEventRecord,
                         kTickSampleQueueLength> ticks_buffer_;
   std::unique_ptr<sampler::Sampler> sampler_;
+  // Number of samples dropped by the sampler because |ticks_buffer_| was full.
+  // Incremented by the sampler and drained by the processor thread.
+  std::atomic<unsigned> dropped_samples_{0};
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
                                      // low sampling intervals on Windows.
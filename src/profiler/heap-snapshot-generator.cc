@@ -2025,6 +2025,13 @@ bool V8HeapExplorer::IterateAndExtractReferences(
 
   bool interrupted = false;
 
+  // Extraction is intentionally single-threaded: entries and edges are
+  // appended to the snapshot's deques in visiting order (edge order defines
+  // the serialized children order), names are interned in the non-thread-safe
+  // StringsStorage, and object names may be resolved through embedder
+  // callbacks that must run on the main thread. Splitting pages across worker
+  // threads would require per-thread entry/edge buffers that are merged and
+  // renumbered afterwards.
   CombinedHeapObjectIterator iterator(heap_,
                                       HeapObjectIterator::kFilterUnreachable);
   PtrComprCageBase cage_base(heap_->isolate());
@@ -2691,6 +2698,12 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
+  // The mapping from heap things to entries is only needed while references
+  // are extracted. Release it before the children index is built so that the
+  // two do not add up to the peak memory use of snapshot generation.
+  HeapEntriesMap().swap(entries_map_);
+  SmiEntriesMap().swap(smis_map_);
+
   snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
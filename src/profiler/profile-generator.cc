@@ -794,9 +794,19 @@ CodeMap::CodeMap(CodeEntryStorage& storage) : code_entries_(storage) {}
 
 CodeMap::~CodeMap() { Clear(); }
 
+namespace {
+
+template <typename T>
+bool StartsBefore(const T& lhs, const T& rhs) {
+  return lhs.start < rhs.start;
+}
+
+}  // namespace
+
 void CodeMap::Clear() {
+  Flush();
   for (auto& slot : code_map_) {
-    if (CodeEntry* entry = slot.second.entry) {
+    if (CodeEntry* entry = slot.entry) {
       code_entries_.DecRef(entry);
     } else {
       // We expect all entries in the code mapping to contain a CodeEntry.
@@ -807,17 +817,89 @@ void CodeMap::Clear() {
   code_map_.clear();
 }
 
+void CodeMap::Flush() {
+  if (removed_count_ > 0) {
+    code_map_.erase(std::remove_if(code_map_.begin(), code_map_.end(),
+                                   [](const CodeEntryMapInfo& info) {
+                                     return info.entry == nullptr;
+                                   }),
+                    code_map_.end());
+    removed_count_ = 0;
+  }
+  if (pending_.empty()) return;
+  // The merge is stable, so entries from |code_map_| stay ahead of the later
+  // added ones from |pending_| that share their start address.
+  const size_t sorted_size = code_map_.size();
+  code_map_.insert(code_map_.end(), pending_.begin(), pending_.end());
+  std::inplace_merge(code_map_.begin(), code_map_.begin() + sorted_size,
+                     code_map_.end(), StartsBefore<CodeEntryMapInfo>);
+  pending_.clear();
+}
+
+void CodeMap::MaybeFlush() {
+  if (pending_.size() >= kMaxPendingEntries ||
+      removed_count_ > code_map_.size() / 2) {
+    Flush();
+  }
+}
+
+void CodeMap::AddPending(const CodeEntryMapInfo& info) {
+  auto it = std::upper_bound(pending_.begin(), pending_.end(), info,
+                             StartsBefore<CodeEntryMapInfo>);
+  pending_.insert(it, info);
+}
+
+const CodeMap::CodeEntryMapInfo* CodeMap::FindPendingEntry(
+    Address addr) const {
+  auto it = std::upper_bound(
+      pending_.begin(), pending_.end(), addr,
+      [](Address addr, const CodeEntryMapInfo& info) {
+        return addr < info.start;
+      });
+  if (it == pending_.begin()) return nullptr;
+  return &*(--it);
+}
+
+const CodeMap::CodeEntryMapInfo* CodeMap::FindSortedEntry(Address addr) const {
+  auto it = std::upper_bound(
+      code_map_.begin(), code_map_.end(), addr,
+      [](Address addr, const CodeEntryMapInfo& info) {
+        return addr < info.start;
+      });
+  while (it != code_map_.begin()) {
+    --it;
+    if (it->entry) return &*it;
+  }
+  return nullptr;
+}
+
 void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
-  code_map_.emplace(addr, CodeEntryMapInfo{entry, size});
+  AddPending(CodeEntryMapInfo{addr, entry, size});
   entry->set_instruction_start(addr);
+  MaybeFlush();
 }
 
 bool CodeMap::RemoveCode(CodeEntry* entry) {
-  auto range = code_map_.equal_range(entry->instruction_start());
-  for (auto i = range.first; i != range.second; ++i) {
-    if (i->second.entry == entry) {
+  const Address addr = entry->instruction_start();
+  auto pending = std::equal_range(pending_.begin(), pending_.end(),
+                                  CodeEntryMapInfo{addr, nullptr, 0},
+                                  StartsBefore<CodeEntryMapInfo>);
+  for (auto it = pending.first; it != pending.second; ++it) {
+    if (it->entry == entry) {
       code_entries_.DecRef(entry);
-      code_map_.erase(i);
+      pending_.erase(it);
+      return true;
+    }
+  }
+  auto it = std::lower_bound(code_map_.begin(), code_map_.end(),
+                             CodeEntryMapInfo{addr, nullptr, 0},
+                             StartsBefore<CodeEntryMapInfo>);
+  for (; it != code_map_.end() && it->start == addr; ++it) {
+    if (it->entry == entry) {
+      code_entries_.DecRef(entry);
+      it->entry = nullptr;
+      removed_count_++;
+      MaybeFlush();
       return true;
     }
   }
@@ -825,68 +907,84 @@ bool CodeMap::RemoveCode(CodeEntry* entry) {
 }
 
 void CodeMap::ClearCodesInRange(Address start, Address end) {
-  auto left = code_map_.upper_bound(start);
+  Flush();
+  auto left = std::upper_bound(
+      code_map_.begin(), code_map_.end(), start,
+      [](Address addr, const CodeEntryMapInfo& info) {
+        return addr < info.start;
+      });
   if (left != code_map_.begin()) {
     --left;
-    if (left->first + left->second.size <= start) ++left;
+    if (left->start + left->size <= start) ++left;
   }
   auto right = left;
-  for (; right != code_map_.end() && right->first < end; ++right) {
-    code_entries_.DecRef(right->second.entry);
+  for (; right != code_map_.end() && right->start < end; ++right) {
+    code_entries_.DecRef(right->entry);
   }
   code_map_.erase(left, right);
 }
 
 CodeEntry* CodeMap::FindEntry(Address addr, Address* out_instruction_start) {
-  // Note that an address may correspond to multiple CodeEntry objects. An
-  // arbitrary selection is made (as per multimap spec) in the event of a
-  // collision.
-  auto it = code_map_.upper_bound(addr);
-  if (it == code_map_.begin()) return nullptr;
-  --it;
-  Address start_address = it->first;
-  Address end_address = start_address + it->second.size;
-  CodeEntry* ret = addr < end_address ? it->second.entry : nullptr;
-  DCHECK(!ret || (addr >= start_address && addr < end_address));
-  if (ret && out_instruction_start) *out_instruction_start = start_address;
-  return ret;
+  // Note that an address may correspond to multiple CodeEntry objects. In the
+  // event of a collision, the most recently added entry is returned.
+  // Entries in |pending_| were added after the ones in |code_map_|, so they
+  // win ties.
+  const CodeEntryMapInfo* info = FindSortedEntry(addr);
+  const CodeEntryMapInfo* pending = FindPendingEntry(addr);
+  if (pending && (!info || pending->start >= info->start)) info = pending;
+  if (info == nullptr || addr >= info->start + info->size) return nullptr;
+  if (out_instruction_start) *out_instruction_start = info->start;
+  return info->entry;
 }
 
 void CodeMap::MoveCode(Address from, Address to) {
   if (from == to) return;
 
-  auto range = code_map_.equal_range(from);
-  // Instead of iterating until |range.second|, iterate the number of elements.
-  // This is because the |range.second| may no longer be the element past the
-  // end of the equal elements range after insertions.
-  size_t distance = std::distance(range.first, range.second);
-  auto it = range.first;
-  while (distance--) {
-    CodeEntryMapInfo& info = it->second;
+  // Entries in |code_map_| were added before the ones in |pending_|. Collect
+  // them in that order so that the moved entries keep their insertion order.
+  std::vector<CodeEntryMapInfo> moved;
+  auto it = std::lower_bound(code_map_.begin(), code_map_.end(),
+                             CodeEntryMapInfo{from, nullptr, 0},
+                             StartsBefore<CodeEntryMapInfo>);
+  for (; it != code_map_.end() && it->start == from; ++it) {
+    if (it->entry == nullptr) continue;
+    moved.push_back(*it);
+    it->entry = nullptr;
+    removed_count_++;
+  }
+  auto pending = std::equal_range(pending_.begin(), pending_.end(),
+                                  CodeEntryMapInfo{from, nullptr, 0},
+                                  StartsBefore<CodeEntryMapInfo>);
+  moved.insert(moved.end(), pending.first, pending.second);
+  pending_.erase(pending.first, pending.second);
+
+  for (CodeEntryMapInfo& info : moved) {
     DCHECK(info.entry);
     DCHECK_EQ(info.entry->instruction_start(), from);
     info.entry->set_instruction_start(to);
 
     DCHECK(from + info.size <= to || to + info.size <= from);
-    code_map_.emplace(to, info);
-    it++;
+    info.start = to;
+    AddPending(info);
   }
-
-  code_map_.erase(range.first, it);
+  MaybeFlush();
 }
 
 void CodeMap::Print() {
-  for (const auto& pair : code_map_) {
-    base::OS::Print("%p %5d %s\n", reinterpret_cast<void*>(pair.first),
-                    pair.second.size, pair.second.entry->name());
+  Flush();
+  for (const auto& info : code_map_) {
+    base::OS::Print("%p %5d %s\n", reinterpret_cast<void*>(info.start),
+                    info.size, info.entry->name());
   }
 }
 
 size_t CodeMap::GetEstimatedMemoryUsage() const {
   size_t map_size = 0;
-  for (const auto& pair : code_map_) {
-    map_size += sizeof(pair.first) + sizeof(pair.second) +
-                pair.second.entry->EstimatedSize();
+  for (const auto* entries : {&code_map_, &pending_}) {
+    for (const auto& info : *entries) {
+      if (info.entry == nullptr) continue;
+      map_size += sizeof(info) + info.entry->EstimatedSize();
+    }
   }
   return sizeof(*this) + map_size;
 }
@@ -1071,6 +1169,15 @@ void CpuProfilesCollection::AddPathToCurrentProfiles(
   current_profiles_semaphore_.Signal();
 }
 
+void CpuProfilesCollection::AddDroppedSamplesToCurrentProfiles(
+    unsigned count) {
+  current_profiles_semaphore_.Wait();
+  for (const std::unique_ptr<CpuProfile>& profile : current_profiles_) {
+    profile->AddDroppedSamples(count);
+  }
+  current_profiles_semaphore_.Signal();
+}
+
 void CpuProfilesCollection::UpdateNativeContextAddressForCurrentProfiles(
     Address from, Address to) {
   current_profiles_semaphore_.Wait();
@@ -1080,5 +1187,181 @@ void CpuProfilesCollection::UpdateNativeContextAddressForCurrentProfiles(
   current_profiles_semaphore_.Signal();
 }
 
+namespace {
+
+// Encoder for the subset of the protocol buffer wire format used by pprof.
+class ProtoEncoder {
+ public:
+  void AddVarint(int field, uint64_t value) {
+    AddTag(field, kVarint);
+    AddRawVarint(value);
+  }
+  void AddBytes(int field, const char* data, size_t length) {
+    AddTag(field, kLengthDelimited);
+    AddRawVarint(length);
+    buffer_.append(data, length);
+  }
+  void AddString(int field, const char* string) {
+    AddBytes(field, string, strlen(string));
+  }
+  void AddMessage(int field, const ProtoEncoder& message) {
+    AddBytes(field, message.buffer_.data(), message.buffer_.size());
+  }
+  void AddPacked(int field, const std::vector<uint64_t>& values) {
+    ProtoEncoder packed;
+    for (uint64_t value : values) packed.AddRawVarint(value);
+    AddMessage(field, packed);
+  }
+
+  const std::string& buffer() const { return buffer_; }
+
+ private:
+  enum WireType { kVarint = 0, kLengthDelimited = 2 };
+
+  void AddTag(int field, WireType type) {
+    AddRawVarint((static_cast<uint64_t>(field) << 3) | type);
+  }
+  void AddRawVarint(uint64_t value) {
+    while (value >= 0x80) {
+      buffer_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    buffer_.push_back(static_cast<char>(value));
+  }
+
+  std::string buffer_;
+};
+
+// Field numbers from perftools.profiles.Profile and its nested messages.
+constexpr int kProfileSampleType = 1;
+constexpr int kProfileSample = 2;
+constexpr int kProfileLocation = 4;
+constexpr int kProfileFunction = 5;
+constexpr int kProfileStringTable = 6;
+constexpr int kProfileDurationNanos = 10;
+constexpr int kProfilePeriodType = 11;
+constexpr int kProfilePeriod = 12;
+constexpr int kValueTypeType = 1;
+constexpr int kValueTypeUnit = 2;
+constexpr int kSampleLocationId = 1;
+constexpr int kSampleValue = 2;
+constexpr int kLocationId = 1;
+constexpr int kLocationLine = 4;
+constexpr int kLineFunctionId = 1;
+constexpr int kLineLine = 2;
+constexpr int kFunctionId = 1;
+constexpr int kFunctionName = 2;
+constexpr int kFunctionSystemName = 3;
+constexpr int kFunctionFilename = 4;
+constexpr int kFunctionStartLine = 5;
+
+}  // namespace
+
+uint64_t CpuProfilePprofSerializer::GetStringId(const char* string) {
+  auto result = string_ids_.emplace(string, strings_.size());
+  if (result.second) strings_.push_back(string);
+  return result.first->second;
+}
+
+uint64_t CpuProfilePprofSerializer::GetFunctionId(const CodeEntry* entry) {
+  // Function ids must be non-zero.
+  auto result = function_ids_.emplace(entry, functions_.size() + 1);
+  if (result.second) functions_.push_back(entry);
+  return result.first->second;
+}
+
+void CpuProfilePprofSerializer::Serialize(v8::OutputStream* stream) {
+  ProtoEncoder message;
+  // The first string table entry must be the empty string.
+  GetStringId("");
+
+  base::TimeDelta interval =
+      base::TimeDelta::FromMicroseconds(profile_->sampling_interval_us());
+  if (interval.IsZero() && profile_->cpu_profiler()) {
+    interval = profile_->cpu_profiler()->sampling_interval();
+  }
+  const uint64_t period_ns = static_cast<uint64_t>(interval.InNanoseconds());
+
+  auto add_value_type = [&](int field, const char* type, const char* unit) {
+    ProtoEncoder value_type;
+    value_type.AddVarint(kValueTypeType, GetStringId(type));
+    value_type.AddVarint(kValueTypeUnit, GetStringId(unit));
+    message.AddMessage(field, value_type);
+  };
+  add_value_type(kProfileSampleType, "samples", "count");
+  add_value_type(kProfileSampleType, "cpu", "nanoseconds");
+  add_value_type(kProfilePeriodType, "cpu", "nanoseconds");
+  message.AddVarint(kProfilePeriod, period_ns);
+  if (profile_->end_time() > profile_->start_time()) {
+    message.AddVarint(kProfileDurationNanos,
+                      static_cast<uint64_t>(
+                          (profile_->end_time() - profile_->start_time())
+                              .InNanoseconds()));
+  }
+
+  // Every node but the root becomes a location with the node id. Nodes that
+  // have self ticks also become a sample whose stack is the path to the root.
+  std::vector<const ProfileNode*> pending = {profile_->top_down()->root()};
+  std::vector<uint64_t> stack;
+  while (!pending.empty()) {
+    const ProfileNode* node = pending.back();
+    pending.pop_back();
+    for (const ProfileNode* child : *node->children()) {
+      pending.push_back(child);
+    }
+    if (node->parent() == nullptr) continue;
+
+    ProtoEncoder line;
+    line.AddVarint(kLineFunctionId, GetFunctionId(node->entry()));
+    if (node->line_number() > 0) line.AddVarint(kLineLine, node->line_number());
+    ProtoEncoder location;
+    location.AddVarint(kLocationId, node->id());
+    location.AddMessage(kLocationLine, line);
+    message.AddMessage(kProfileLocation, location);
+
+    if (node->self_ticks() == 0) continue;
+    stack.clear();
+    for (const ProfileNode* frame = node; frame->parent() != nullptr;
+         frame = frame->parent()) {
+      stack.push_back(frame->id());
+    }
+    ProtoEncoder sample;
+    sample.AddPacked(kSampleLocationId, stack);
+    sample.AddPacked(kSampleValue,
+                     {node->self_ticks(), node->self_ticks() * period_ns});
+    message.AddMessage(kProfileSample, sample);
+  }
+
+  for (size_t i = 0; i < functions_.size(); ++i) {
+    const CodeEntry* entry = functions_[i];
+    const char* name = *entry->name() ? entry->name() : "(anonymous)";
+    ProtoEncoder function;
+    function.AddVarint(kFunctionId, i + 1);
+    function.AddVarint(kFunctionName, GetStringId(name));
+    function.AddVarint(kFunctionSystemName, GetStringId(name));
+    function.AddVarint(kFunctionFilename, GetStringId(entry->resource_name()));
+    if (entry->line_number() > 0) {
+      function.AddVarint(kFunctionStartLine, entry->line_number());
+    }
+    message.AddMessage(kProfileFunction, function);
+  }
+
+  for (const char* string : strings_) {
+    message.AddString(kProfileStringTable, string);
+  }
+
+  const std::string& data = message.buffer();
+  const size_t chunk_size = static_cast<size_t>(stream->GetChunkSize());
+  for (size_t pos = 0; pos < data.size(); pos += chunk_size) {
+    int length = static_cast<int>(std::min(chunk_size, data.size() - pos));
+    if (stream->WriteBinaryChunk(
+            reinterpret_cast<const uint8_t*>(data.data() + pos), length) ==
+        v8::OutputStream::kAbort) {
+      return;
+    }
+  }
+  stream->EndOfStream();
+}
+
 }  // namespace internal
 }  // namespace v8
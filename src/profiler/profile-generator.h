@@ -10,6 +10,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -433,6 +434,9 @@ class CpuProfile {
   int samples_count() const { return static_cast<int>(samples_.size()); }
   const SampleInfo& sample(int index) const { return samples_[index]; }
 
+  void AddDroppedSamples(unsigned count) { dropped_samples_count_ += count; }
+  unsigned dropped_samples_count() const { return dropped_samples_count_; }
+
   int64_t sampling_interval_us() const {
     return options_.sampling_interval_us();
   }
@@ -457,6 +461,7 @@ class CpuProfile {
   base::TimeTicks start_time_;
   base::TimeTicks end_time_;
   std::deque<SampleInfo> samples_;
+  unsigned dropped_samples_count_ = 0;
   ProfileTree top_down_;
   CpuProfiler* const profiler_;
   size_t streaming_next_sample_;
@@ -495,7 +500,9 @@ class V8_EXPORT_PRIVATE CodeMap {
   void ClearCodesInRange(Address start, Address end);
   CodeEntry* FindEntry(Address addr, Address* out_instruction_start = nullptr);
   void Print();
-  size_t size() const { return code_map_.size(); }
+  size_t size() const {
+    return code_map_.size() - removed_count_ + pending_.size();
+  }
 
   size_t GetEstimatedMemoryUsage() const;
 
@@ -505,11 +512,36 @@ class V8_EXPORT_PRIVATE CodeMap {
 
  private:
   struct CodeEntryMapInfo {
+    Address start;
+    // Null for entries that were removed from |code_map_| but not yet
+    // compacted away.
     CodeEntry* entry;
     unsigned size;
   };
 
-  std::multimap<Address, CodeEntryMapInfo> code_map_;
+  // Upper bound on |pending_|, which bounds the cost of inserting into it.
+  static constexpr size_t kMaxPendingEntries = 128;
+
+  // Merges |pending_| into |code_map_| and compacts removed entries.
+  void Flush();
+  void MaybeFlush();
+  // Inserts |info| into |pending_| after all entries with the same start.
+  void AddPending(const CodeEntryMapInfo& info);
+  // Returns the last live entry in |code_map_| that starts at or before
+  // |addr|, or nullptr.
+  const CodeEntryMapInfo* FindSortedEntry(Address addr) const;
+  // Returns the most recently added entry in |pending_| that starts at or
+  // before |addr|, or nullptr.
+  const CodeEntryMapInfo* FindPendingEntry(Address addr) const;
+
+  // Entries sorted by start address. Entries sharing a start address are kept
+  // in insertion order, so the most recently added one comes last.
+  std::vector<CodeEntryMapInfo> code_map_;
+  // Entries added since the last Flush(), sorted like |code_map_| but without
+  // removed entries. Buffering them turns bursts of code creation and move
+  // events into batched merges rather than one shift of |code_map_| per event.
+  std::vector<CodeEntryMapInfo> pending_;
+  size_t removed_count_ = 0;
   CodeEntryStorage& code_entries_;
 };
 
@@ -569,6 +601,9 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
       Address native_context_address = kNullAddress,
       Address native_embedder_context_address = kNullAddress);
 
+  // Called from profile generator thread.
+  void AddDroppedSamplesToCurrentProfiles(unsigned count);
+
   // Called from profile generator thread.
   void UpdateNativeContextAddressForCurrentProfiles(Address from, Address to);
 
@@ -591,6 +626,30 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   Isolate* isolate_;
 };
 
+// Writes a CpuProfile as an uncompressed pprof protocol buffer message.
+class V8_EXPORT_PRIVATE CpuProfilePprofSerializer {
+ public:
+  explicit CpuProfilePprofSerializer(const CpuProfile* profile)
+      : profile_(profile) {}
+  CpuProfilePprofSerializer(const CpuProfilePprofSerializer&) = delete;
+  CpuProfilePprofSerializer& operator=(const CpuProfilePprofSerializer&) =
+      delete;
+
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  // Returns the index of |string| in the string table, adding it if needed.
+  uint64_t GetStringId(const char* string);
+  // Returns the pprof function id for |entry|, adding it if needed.
+  uint64_t GetFunctionId(const CodeEntry* entry);
+
+  const CpuProfile* const profile_;
+  std::unordered_map<std::string, uint64_t> string_ids_;
+  std::vector<const char*> strings_;
+  std::unordered_map<const CodeEntry*, uint64_t> function_ids_;
+  std::vector<const CodeEntry*> functions_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -113,6 +113,22 @@ void SamplingHeapProfiler::OnWeakCallback(
   // sample is deleted because its unique ptr was erased from samples_.
 }
 
+const char* SamplingHeapProfiler::GetFunctionName(SharedFunctionInfo shared) {
+  // Symbolizing a frame flattens and copies the debug name and then hashes it
+  // into the strings storage. Deep stacks mostly repeat the same functions, so
+  // remember the interned name per SharedFunctionInfo. The cache is keyed by
+  // object address, which is only stable until the next GC.
+  if (function_names_gc_count_ != heap_->gc_count()) {
+    function_names_.clear();
+    function_names_gc_count_ = heap_->gc_count();
+  }
+  auto it = function_names_.find(shared.ptr());
+  if (it != function_names_.end()) return it->second;
+  const char* name = names()->GetCopy(shared.DebugNameCStr().get());
+  function_names_.emplace(shared.ptr(), name);
+  return name;
+}
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
     AllocationNode* parent, const char* name, int script_id,
     int start_position) {
@@ -190,7 +206,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
     SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
+    const char* name = GetFunctionName(shared);
     int script_id = v8::UnboundScript::kNoScriptId;
     if (shared.script().IsScript()) {
       Script script = Script::cast(shared.script());
@@ -166,6 +166,10 @@ class SamplingHeapProfiler {
                                      int script_id, int start_position);
   static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
 
+  // Returns the interned debug name of *shared*, consulting a cache that is
+  // valid until the next GC before symbolizing.
+  const char* GetFunctionName(SharedFunctionInfo shared);
+
   uint32_t next_node_id() { return ++last_node_id_; }
   uint64_t next_sample_id() { return ++last_sample_id_; }
 
@@ -191,6 +195,10 @@ class SamplingHeapProfiler {
   StringsStorage* const names_;
   AllocationNode profile_root_;
   std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Interned function names keyed by SharedFunctionInfo address. Cleared
+  // whenever a GC has happened since objects may have moved.
+  std::unordered_map<Address, const char*> function_names_;
+  int function_names_gc_count_ = -1;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
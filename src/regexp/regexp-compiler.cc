@@ -2931,6 +2931,12 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
   if (found_single_character) {
     Label cont, again;
+    // Skip over blocks of input without a candidate first, if the backend
+    // supports it. The loop below then handles the candidate and the tail.
+    masm->SkipUntilCharacterAfterAnd(
+        single_character,
+        max_char_ > kSize ? RegExpMacroAssembler::kTableMask : 0xFFFF,
+        max_lookahead);
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
     if (max_char_ > kSize) {
@@ -354,6 +354,19 @@ bool RegExpMacroAssemblerTracer::CheckCharacterNotInRangeArray(
   return assembler_->CheckCharacterNotInRangeArray(ranges, on_not_in_range);
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacterAfterAnd(unsigned c,
+                                                            unsigned and_with,
+                                                            int cp_offset) {
+  bool supported =
+      assembler_->SkipUntilCharacterAfterAnd(c, and_with, cp_offset);
+  PrintablePrinter printable(c);
+  PrintF(" SkipUntilCharacterAfterAnd(c=0x%04x%s, mask=0x%04x, cp_offset=%d): "
+         "%s;\n",
+         c, *printable, and_with, cp_offset,
+         supported ? "true" : "false");
+  return supported;
+}
+
 void RegExpMacroAssemblerTracer::CheckBitInTable(
     Handle<ByteArray> table, Label* on_bit_set) {
   PrintF(" CheckBitInTable(label[%08x] ", LabelToInt(on_bit_set));
@@ -105,6 +105,17 @@ class RegExpMacroAssembler {
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
 
+  // Advances the current position over blocks of input in which no character
+  // at |cp_offset| from the current position, bitwise anded with |and_with|,
+  // equals |c|. The position is left at the first such candidate, or at an
+  // arbitrary position before it when the end of the input is near, so the
+  // caller still has to check the character afterwards. Returns false if
+  // nothing was emitted.
+  virtual bool SkipUntilCharacterAfterAnd(unsigned c, unsigned and_with,
+                                          int cp_offset) {
+    return false;
+  }
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
@@ -578,6 +578,46 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(uint32_t c,
+                                                         uint32_t and_with,
+                                                         int cp_offset) {
+  // Broadcast the character and the mask to all lanes of xmm1 and xmm2.
+  const uint32_t lane_mask = mode_ == LATIN1 ? 0xFF : 0xFFFF;
+  const uint32_t lanes = mode_ == LATIN1 ? 0x01010101 : 0x00010001;
+  __ movl(rax, Immediate(static_cast<int32_t>((c & lane_mask) * lanes)));
+  __ movd(xmm1, rax);
+  __ pshufd(xmm1, xmm1, 0);
+  __ movl(rax, Immediate(static_cast<int32_t>((and_with & lane_mask) * lanes)));
+  __ movd(xmm2, rax);
+  __ pshufd(xmm2, xmm2, 0);
+
+  Label loop, found, done;
+  __ bind(&loop);
+  // Stop when fewer than 16 bytes of input are left at the lookahead position.
+  __ leaq(rax, Operand(rdi, cp_offset * char_size()));
+  __ cmpq(rax, Immediate(-kSimd128Size));
+  __ j(greater, &done, Label::kNear);
+  __ movdqu(xmm0, Operand(rsi, rax, times_1, 0));
+  __ pand(xmm0, xmm2);
+  if (mode_ == LATIN1) {
+    __ pcmpeqb(xmm0, xmm1);
+  } else {
+    __ pcmpeqw(xmm0, xmm1);
+  }
+  __ pmovmskb(rax, xmm0);
+  __ testl(rax, rax);
+  __ j(not_zero, &found, Label::kNear);
+  __ addq(rdi, Immediate(kSimd128Size));
+  __ jmp(&loop);
+
+  __ bind(&found);
+  // The lowest set bit is the byte offset of the first candidate.
+  __ bsfl(rax, rax);
+  __ addq(rdi, rax);
+  __ bind(&done);
+  return true;
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -424,5 +427,38 @@ RUNTIME_FUNCTION(Runtime_ArrayIndexOf) {
   return Smi::FromInt(-1);
 }
 
+// Sorts the first {length} elements of the Array.prototype.sort work array by
+// the default (string) order if all of them are Smis. Two Smis compare equal
+// only if they have the same value, so an unstable sort is not observable.
+// Returns false without touching the work array if a non-Smi is found.
+RUNTIME_FUNCTION(Runtime_ArraySortSmisLexicographically) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(2, args.length());
+  FixedArray work_array = FixedArray::cast(args[0]);
+  int length = args.smi_value_at(1);
+  CHECK_LE(0, length);
+  CHECK_LE(length, work_array.length());
+
+  DisallowGarbageCollection no_gc;
+  std::vector<int> values;
+  values.reserve(length);
+  for (int i = 0; i < length; i++) {
+    Object element = work_array.get(i);
+    if (!element.IsSmi()) return ReadOnlyRoots(isolate).false_value();
+    values.push_back(Smi::ToInt(element));
+  }
+
+  std::sort(values.begin(), values.end(), [isolate](int x, int y) {
+    Smi result(
+        Smi::LexicographicCompare(isolate, Smi::FromInt(x), Smi::FromInt(y)));
+    return result.value() < 0;
+  });
+
+  for (int i = 0; i < length; i++) {
+    work_array.set(i, Smi::FromInt(values[i]));
+  }
+  return ReadOnlyRoots(isolate).true_value();
+}
+
 }  // namespace internal
 }  // namespace v8
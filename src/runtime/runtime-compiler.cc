@@ -258,6 +258,18 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return ReadOnlyRoots(isolate).undefined_value();
   }
 
+  if (optimized_code->kind() == CodeKind::TURBOFAN &&
+      function->has_feedback_vector()) {
+    function->feedback_vector().SaturatingIncrementTurbofanDeoptCount();
+  }
+
+  // Don't let the code cache tell the next process to tier up early a function
+  // whose optimized code turned out to be unstable.
+  if (V8_UNLIKELY(FLAG_code_cache_tiering_hints) &&
+      optimized_code->kind() == CodeKind::TURBOFAN) {
+    function->shared().set_was_marked_for_turbofan(false);
+  }
+
   // Non-OSR'd code is deoptimized unconditionally.
   //
   // For OSR'd code, we keep the optimized code around if deoptimization occurs
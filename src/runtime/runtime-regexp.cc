@@ -621,6 +621,101 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalAtomRegExpWithString(
   return *result;
 }
 
+// Replaces all matches of a non-atom regexp with a string that contains no
+// substitution patterns. Match boundaries are collected into the reusable
+// indices list so that the result is written into a single flat string
+// instead of going through a ReplacementStringBuilder.
+template <typename ResultSeqString>
+V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithSimpleString(
+    Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
+    Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info,
+    RegExpGlobalCache* global_cache, int32_t* current_match) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+  int subject_len = subject->length();
+  int replacement_len = replacement->length();
+
+  int64_t result_len_64 = subject_len;
+  do {
+    int start = current_match[0];
+    int end = current_match[1];
+    indices->push_back(start);
+    indices->push_back(end);
+    result_len_64 += static_cast<int64_t>(replacement_len) - (end - start);
+    current_match = global_cache->FetchNext();
+  } while (current_match != nullptr);
+
+  if (global_cache->HasException()) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+
+  RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                           regexp->capture_count(),
+                           global_cache->LastSuccessfulMatch());
+
+  // Detect integer overflow.
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    static_assert(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+  if (result_len == 0) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).empty_string();
+  }
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  if (!maybe_res.ToHandle(&untyped_res)) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+  Handle<ResultSeqString> result = Handle<ResultSeqString>::cast(untyped_res);
+
+  int subject_pos = 0;
+  int result_pos = 0;
+
+  DisallowGarbageCollection no_gc;
+  for (size_t i = 0; i < indices->size(); i += 2) {
+    int start = (*indices)[i];
+    int end = (*indices)[i + 1];
+    // Copy non-matched subject content.
+    if (subject_pos < start) {
+      String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                          subject_pos, start - subject_pos);
+      result_pos += start - subject_pos;
+    }
+
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, result->GetChars(no_gc) + result_pos, 0,
+                          replacement_len);
+      result_pos += replacement_len;
+    }
+
+    subject_pos = end;
+  }
+  // Add remaining subject content at the end.
+  if (subject_pos < subject_len) {
+    String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                        subject_pos, subject_len - subject_pos);
+  }
+
+  TruncateRegexpIndicesList(isolate);
+
+  return *result;
+}
+
 V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
     Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
@@ -660,6 +755,19 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     return *subject;
   }
 
+  if (simple_replace) {
+    if (subject->IsOneByteRepresentation() &&
+        replacement->IsOneByteRepresentation()) {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqOneByteString>(
+          isolate, subject, regexp, replacement, last_match_info,
+          &global_cache, current_match);
+    } else {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqTwoByteString>(
+          isolate, subject, regexp, replacement, last_match_info,
+          &global_cache, current_match);
+    }
+  }
+
   // Guessing the number of parts that the final result string is built
   // from. Global regexps can match any number of times, so we guess
   // conservatively.
@@ -678,11 +786,7 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
       builder.AddSubjectSlice(prev, start);
     }
 
-    if (simple_replace) {
-      builder.AddString(replacement);
-    } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
-    }
+    compiled_replacement.Apply(&builder, start, end, current_match);
     prev = end;
 
     current_match = global_cache.FetchNext();
@@ -40,16 +40,17 @@ namespace internal {
 // inline), use the F macro below. To declare the runtime version and the inline
 // version simultaneously, use the I macro below.
 
-#define FOR_EACH_INTRINSIC_ARRAY(F, I) \
-  F(ArrayIncludes_Slow, 3, 1)          \
-  F(ArrayIndexOf, 3, 1)                \
-  F(ArrayIsArray, 1, 1)                \
-  F(ArraySpeciesConstructor, 1, 1)     \
-  F(GrowArrayElements, 2, 1)           \
-  F(IsArray, 1, 1)                     \
-  F(NewArray, -1 /* >= 3 */, 1)        \
-  F(NormalizeElements, 1, 1)           \
-  F(TransitionElementsKind, 2, 1)      \
+#define FOR_EACH_INTRINSIC_ARRAY(F, I)    \
+  F(ArrayIncludes_Slow, 3, 1)             \
+  F(ArrayIndexOf, 3, 1)                   \
+  F(ArrayIsArray, 1, 1)                   \
+  F(ArraySortSmisLexicographically, 2, 1) \
+  F(ArraySpeciesConstructor, 1, 1)        \
+  F(GrowArrayElements, 2, 1)              \
+  F(IsArray, 1, 1)                        \
+  F(NewArray, -1 /* >= 3 */, 1)           \
+  F(NormalizeElements, 1, 1)              \
+  F(TransitionElementsKind, 2, 1)         \
   F(TransitionElementsKindWithKind, 2, 1)
 
 #define FOR_EACH_INTRINSIC_ATOMICS(F, I)               \
@@ -28,11 +28,37 @@ uint32_t ExternalPointerTable::Sweep(Isolate* isolate) {
   // which helps defragment the table. This method must run either on the
   // mutator thread or while the mutator is stopped. Also clear marking bits on
   // live entries.
-  // TODO(v8:10391, saelo) could also shrink the table using DecommitPages() if
-  // elements at the end are free. This might require some form of compaction.
+  // TODO(v8:10391, saelo) only trailing blocks without live entries are
+  // released below. Releasing blocks in the middle of the table would require
+  // some form of compaction.
   uint32_t freelist_size = 0;
   uint32_t current_freelist_head = 0;
 
+  // Drop trailing blocks that contain no live entries from the table and give
+  // their memory back to the OS instead of threading them onto the freelist.
+  // The first block, which contains the null entry, is always kept.
+  DCHECK_EQ(0, capacity_ % kEntriesPerBlock);
+  uint32_t new_capacity = capacity_;
+  while (new_capacity > kEntriesPerBlock) {
+    uint32_t block_start = new_capacity - kEntriesPerBlock;
+    bool block_is_dead = true;
+    for (uint32_t i = block_start; i < new_capacity; i++) {
+      if (is_marked(load(i))) {
+        block_is_dead = false;
+        break;
+      }
+    }
+    if (!block_is_dead) break;
+    new_capacity = block_start;
+  }
+  if (new_capacity < capacity_) {
+    VirtualAddressSpace* root_space = GetPlatformVirtualAddressSpace();
+    CHECK(root_space->DecommitPages(buffer_ + new_capacity * sizeof(Address),
+                                    (capacity_ - new_capacity) *
+                                        sizeof(Address)));
+    capacity_ = new_capacity;
+  }
+
   // Skip the special null entry.
   DCHECK_GE(capacity_, 1);
   for (uint32_t i = capacity_ - 1; i > 0; i--) {
@@ -51,7 +51,8 @@ class Isolate;
  *    marking bit using an atomic CAS operation.
  *  - When marking is finished, Sweep() iterates of the table once while the
  *    mutator is stopped and builds a freelist from all dead entries while also
- *    removing the marking bit from any live entry.
+ *    removing the marking bit from any live entry. Trailing blocks without
+ *    any live entries are decommitted and removed from the table.
  *
  * The freelist is a singly-linked list, using the lower 32 bits of each entry
  * to store the index of the next free entry. When the freelist is empty and a
@@ -143,6 +143,10 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
     if (SerializeReadOnlyObject(raw, no_gc)) return;
 
     instance_type = raw.map().instance_type();
+    // The code cache only holds bytecode. Optimized code embeds
+    // context-specific maps and relies on CompilationDependencies that are
+    // only valid in the isolate that created it, so it is never serialized;
+    // deserialized functions tier up again through the usual path.
     CHECK(!InstanceTypeChecker::IsCode(instance_type));
 
     if (ElideObject(raw)) {
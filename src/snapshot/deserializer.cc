@@ -232,6 +232,8 @@ int GetNumApiReferences(Isolate* isolate) {
 }
 int GetNumApiReferences(LocalIsolate* isolate) { return 0; }
 #endif
+Heap* HeapOf(Isolate* isolate) { return isolate->heap(); }
+Heap* HeapOf(LocalIsolate* isolate) { return isolate->heap()->heap(); }
 }  // namespace
 
 template <typename IsolateT>
@@ -245,7 +247,8 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
       magic_number_(magic_number),
       deserializing_user_code_(deserializing_user_code),
       should_rehash_((FLAG_rehash_snapshot && can_rehash) ||
-                     deserializing_user_code) {
+                     deserializing_user_code),
+      no_gc_stats_(HeapOf(isolate)) {
   DCHECK_NOT_NULL(isolate);
   isolate->RegisterDeserializerStarted();
 
@@ -258,17 +258,21 @@ class Deserializer : public SerializerDeserializer {
   // be in an invalid state
   class V8_NODISCARD DisableGCStats {
    public:
-    explicit DisableGCStats() {
+    explicit DisableGCStats(Heap* heap) : heap_(heap) {
+      // Also covers object stats sampled without tracing.
+      heap_->DisableObjectStats();
       if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
       was_enabled_ = true;
       TracingFlags::gc_stats = false;
     }
     ~DisableGCStats() {
+      heap_->EnableObjectStats();
       if (V8_LIKELY(!was_enabled_)) return;
       TracingFlags::gc_stats = true;
     }
 
    private:
+    Heap* const heap_;
     bool was_enabled_ = false;
   };
   DisableGCStats no_gc_stats_;
@@ -6,11 +6,14 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include "src/base/optional.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/js-regexp-inl.h"
@@ -130,6 +133,36 @@ SnapshotData MaybeDecompress(Isolate* isolate,
 #endif
 }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+namespace {
+
+class SnapshotDecompressionTask final : public v8::Task {
+ public:
+  SnapshotDecompressionTask(base::Vector<const byte> compressed_data,
+                            base::Optional<SnapshotData>* result,
+                            base::Semaphore* done)
+      : compressed_data_(compressed_data), result_(result), done_(done) {}
+
+  void Run() final {
+    TRACE_EVENT0("v8", "V8.SnapshotDecompress");
+    result_->emplace(SnapshotCompression::Decompress(compressed_data_));
+    done_->Signal();
+  }
+
+ private:
+  base::Vector<const byte> compressed_data_;
+  base::Optional<SnapshotData>* result_;
+  base::Semaphore* done_;
+};
+
+bool ShouldDecompressInParallel() {
+  return FLAG_parallel_snapshot_decompression &&
+         V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0;
+}
+
+}  // namespace
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -178,14 +211,33 @@ bool Snapshot::Initialize(Isolate* isolate) {
   base::Vector<const byte> shared_heap_data =
       SnapshotImpl::ExtractSharedHeapData(blob);
 
+  base::Optional<SnapshotData> read_only_snapshot_data;
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // The blobs are compressed independently, so the read-only one can be
+  // decompressed concurrently with the others.
+  base::Semaphore read_only_decompressed(0);
+  const bool decompress_in_parallel = ShouldDecompressInParallel();
+  if (decompress_in_parallel) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<SnapshotDecompressionTask>(
+            read_only_data, &read_only_snapshot_data, &read_only_decompressed));
+  }
+#else
+  const bool decompress_in_parallel = false;
+#endif  // V8_SNAPSHOT_COMPRESSION
+
   SnapshotData startup_snapshot_data(MaybeDecompress(isolate, startup_data));
-  SnapshotData read_only_snapshot_data(
-      MaybeDecompress(isolate, read_only_data));
+  if (!decompress_in_parallel) {
+    read_only_snapshot_data.emplace(MaybeDecompress(isolate, read_only_data));
+  }
   SnapshotData shared_heap_snapshot_data(
       MaybeDecompress(isolate, shared_heap_data));
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (decompress_in_parallel) read_only_decompressed.Wait();
+#endif  // V8_SNAPSHOT_COMPRESSION
 
   bool success = isolate->InitWithSnapshot(
-      &startup_snapshot_data, &read_only_snapshot_data,
+      &startup_snapshot_data, &read_only_snapshot_data.value(),
       &shared_heap_snapshot_data, ExtractRehashability(blob));
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
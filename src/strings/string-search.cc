@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include "src/base/bits.h"
+
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+#if V8_HOST_HAS_SSE2
+int FindFirstTwoByteCharacterSSE2(const base::uc16* subject, int index,
+                                  int max_n, base::uc16 character) {
+  // memchr can only look for one byte of the character, which matches often
+  // in two-byte text. Compare whole 16-bit lanes instead, eight characters at
+  // a time.
+  const __m128i needle = _mm_set1_epi16(static_cast<int16_t>(character));
+  int i = index;
+  for (; i + 8 <= max_n; i += 8) {
+    const __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    const int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chars, needle));
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask) / 2;
+  }
+  for (; i < max_n; ++i) {
+    if (subject[i] == character) return i;
+  }
+  return -1;
+}
+#endif  // V8_HOST_HAS_SSE2
+
+}  // namespace internal
+}  // namespace v8
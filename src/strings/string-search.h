@@ -5,6 +5,7 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/build_config.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
@@ -194,6 +195,14 @@ inline uint8_t GetHighestValueByte(base::uc16 character) {
 
 inline uint8_t GetHighestValueByte(uint8_t character) { return character; }
 
+#if V8_HOST_HAS_SSE2
+// Returns the index of the first occurrence of {character} in
+// subject[index, max_n), or -1.
+V8_EXPORT_PRIVATE int FindFirstTwoByteCharacterSSE2(const base::uc16* subject,
+                                                    int index, int max_n,
+                                                    base::uc16 character);
+#endif  // V8_HOST_HAS_SSE2
+
 template <typename PatternChar, typename SubjectChar>
 inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
                               base::Vector<const SubjectChar> subject,
@@ -201,6 +210,14 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
 
+#if V8_HOST_HAS_SSE2
+  if (sizeof(SubjectChar) == 2) {
+    return FindFirstTwoByteCharacterSSE2(
+        reinterpret_cast<const base::uc16*>(subject.begin()), index, max_n,
+        static_cast<base::uc16>(pattern_first_char));
+  }
+#endif  // V8_HOST_HAS_SSE2
+
   if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
     // Special-case looking for the 0 char in other than one-byte strings.
     // memchr mostly fails in this case due to every other byte being 0 in text
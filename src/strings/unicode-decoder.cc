@@ -4,12 +4,59 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include "src/base/build_config.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+int NonAsciiStart(const uint8_t* chars, int length) {
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+
+  if (static_cast<size_t>(length) >= kIntptrSize) {
+    // Check unaligned bytes.
+    while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
+      if (*chars > unibrow::Utf8::kMaxOneByteChar) {
+        return static_cast<int>(chars - start);
+      }
+      ++chars;
+    }
+#if V8_HOST_HAS_SSE2
+    // Check 16 bytes at a time; the word loop below narrows down the position
+    // of the first non-one-byte character.
+    while (chars + sizeof(__m128i) <= limit) {
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+      if (_mm_movemask_epi8(bytes) != 0) break;
+      chars += sizeof(__m128i);
+    }
+#endif
+    // Check aligned words.
+    DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
+    const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
+    while (chars + sizeof(uintptr_t) <= limit) {
+      if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
+        return static_cast<int>(chars - start);
+      }
+      chars += sizeof(uintptr_t);
+    }
+  }
+  // Check remaining unaligned bytes.
+  while (chars < limit) {
+    if (*chars > unibrow::Utf8::kMaxOneByteChar) {
+      return static_cast<int>(chars - start);
+    }
+    ++chars;
+  }
+
+  return static_cast<int>(chars - start);
+}
+
 Utf8Decoder::Utf8Decoder(const base::Vector<const uint8_t>& chars)
     : encoding_(Encoding::kAscii),
       non_ascii_start_(NonAsciiStart(chars.begin(), chars.length())),
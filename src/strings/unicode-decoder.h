@@ -15,38 +15,7 @@ namespace internal {
 // non-one-byte character, rather than directly to the non-one-byte character.
 // If the return value is >= the passed length, the entire string was
 // one-byte.
-inline int NonAsciiStart(const uint8_t* chars, int length) {
-  const uint8_t* start = chars;
-  const uint8_t* limit = chars + length;
-
-  if (static_cast<size_t>(length) >= kIntptrSize) {
-    // Check unaligned bytes.
-    while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
-      if (*chars > unibrow::Utf8::kMaxOneByteChar) {
-        return static_cast<int>(chars - start);
-      }
-      ++chars;
-    }
-    // Check aligned words.
-    DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
-    const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
-    while (chars + sizeof(uintptr_t) <= limit) {
-      if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
-        return static_cast<int>(chars - start);
-      }
-      chars += sizeof(uintptr_t);
-    }
-  }
-  // Check remaining unaligned bytes.
-  while (chars < limit) {
-    if (*chars > unibrow::Utf8::kMaxOneByteChar) {
-      return static_cast<int>(chars - start);
-    }
-    ++chars;
-  }
-
-  return static_cast<int>(chars - start);
-}
+V8_EXPORT_PRIVATE int NonAsciiStart(const uint8_t* chars, int length);
 
 class V8_EXPORT_PRIVATE Utf8Decoder final {
  public:
@@ -234,6 +234,16 @@ bool SetPermissions(v8::PageAllocator* page_allocator, void* address,
   return page_allocator->SetPermissions(address, size, access);
 }
 
+void AdviseHugePages(Address address, size_t size) {
+  if (!FLAG_transparent_huge_pages) return;
+  if (!base::OS::AdviseHugePages(reinterpret_cast<void*>(address), size) &&
+      FLAG_trace_gc_verbose) {
+    base::OS::Print("Failed to advise huge pages for [%p, %p)\n",
+                    reinterpret_cast<void*>(address),
+                    reinterpret_cast<void*>(address + size));
+  }
+}
+
 bool OnCriticalMemoryPressure(size_t length) {
   // TODO(bbudge) Rework retry logic once embedders implement the more
   // informative overload.
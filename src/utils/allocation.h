@@ -178,6 +178,11 @@ inline bool SetPermissions(v8::PageAllocator* page_allocator, Address address,
                         access);
 }
 
+// Hints the OS to back the given region with transparent huge pages if
+// --transparent-huge-pages is enabled. |address| must be a multiple of
+// CommitPageSize(). This is a best-effort hint and never fails.
+V8_EXPORT_PRIVATE void AdviseHugePages(Address address, size_t size);
+
 // Function that may release reserved memory regions to allow failed allocations
 // to succeed. |length| is the amount of memory needed. Returns |true| if memory
 // could be released, false otherwise.
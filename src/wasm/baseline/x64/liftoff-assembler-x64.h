@@ -5,6 +5,7 @@
 #ifndef V8_WASM_BASELINE_X64_LIFTOFF_ASSEMBLER_X64_H_
 #define V8_WASM_BASELINE_X64_LIFTOFF_ASSEMBLER_X64_H_
 
+#include "src/base/overflowing-math.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/cpu-features.h"
@@ -1042,9 +1043,9 @@ void LiftoffAssembler::emit_i32_sub(Register dst, Register lhs, Register rhs) {
 
 void LiftoffAssembler::emit_i32_subi(Register dst, Register lhs, int32_t imm) {
   if (dst != lhs) {
-    // We'll have to implement an UB-safe version if we need this corner case.
-    DCHECK_NE(imm, kMinInt);
-    leal(dst, Operand(lhs, -imm));
+    // Negating {kMinInt} wraps around to itself, which still computes
+    // {lhs - imm} modulo 2^32.
+    leal(dst, Operand(lhs, base::NegateWithWraparound(imm)));
   } else {
     subl(dst, Immediate(imm));
   }
@@ -601,6 +601,10 @@ class CompilationStateImpl {
   void CommitTopTierCompilationUnit(WasmCompilationUnit);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
+  // Returns true the first time it is called for {declared_func_index}, so
+  // that each function is queued for speculative compilation at most once.
+  bool MarkSpeculativelyQueued(int declared_func_index);
+
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
 
   base::Optional<WasmCompilationUnit> GetNextCompilationUnit(
@@ -744,6 +748,10 @@ class CompilationStateImpl {
   // compiling.
   std::shared_ptr<WireBytesStorage> wire_bytes_storage_;
 
+  // Declared functions already queued by {MarkSpeculativelyQueued}. Sized
+  // lazily on first use.
+  std::vector<bool> speculatively_queued_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -1146,6 +1154,70 @@ bool IsLazyModule(const WasmModule* module) {
          (FLAG_asm_wasm_lazy_compilation && is_asmjs_module(module));
 }
 
+// Queue background compilation units for the lazily compiled functions that
+// {func_index} calls directly and that have no code yet. Without this, each of
+// them would be compiled on the main thread on its first call.
+void CompileLazyCalleesInBackground(NativeModule* native_module,
+                                    int func_index) {
+  // Callees have not been validated yet with lazy validation, and a failing
+  // background unit would fail the whole module.
+  if (FLAG_wasm_lazy_validation) return;
+  // Liftoff code with speculative inlining uses the instance's feedback vector,
+  // which only {CompileLazy} allocates on the main thread.
+  if (FLAG_wasm_speculative_inlining) return;
+  if (native_module->IsTieredDown()) return;
+
+  const WasmModule* module = native_module->module();
+  auto enabled_features = native_module->enabled_features();
+  const bool lazy_module = IsLazyModule(module);
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  base::Vector<const uint8_t> code =
+      compilation_state->GetWireBytesStorage()->GetCode(
+          module->functions[func_index].code);
+
+  std::vector<WasmCompilationUnit> baseline_units;
+  std::vector<WasmCompilationUnit> top_tier_units;
+  Zone zone(GetWasmEngine()->allocator(), ZONE_NAME);
+  BodyLocalDecls locals(&zone);
+  BytecodeIterator iterator(code.begin(), code.end(), &locals);
+  for (; iterator.has_next(); iterator.next()) {
+    WasmOpcode opcode = iterator.current();
+    if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+    uint32_t length;
+    uint32_t callee_index =
+        iterator.read_u32v<Decoder::kNoValidation>(iterator.pc() + 1, &length);
+    if (callee_index < module->num_imported_functions) continue;
+    DCHECK_LT(callee_index, module->functions.size());
+    CompileStrategy strategy = GetCompileStrategy(module, enabled_features,
+                                                  callee_index, lazy_module);
+    if (strategy != CompileStrategy::kLazy &&
+        strategy != CompileStrategy::kLazyBaselineEagerTopTier) {
+      continue;
+    }
+    if (native_module->HasCode(callee_index)) continue;
+    if (!compilation_state->MarkSpeculativelyQueued(
+            declared_function_index(module, callee_index))) {
+      continue;
+    }
+    ExecutionTierPair tiers = GetRequestedExecutionTiers(
+        native_module, enabled_features, callee_index);
+    baseline_units.emplace_back(callee_index, tiers.baseline_tier,
+                                kNoDebugging);
+    // Match {CompileLazy}, which queues the top tier right after the baseline
+    // tier for lazy functions.
+    if (strategy == CompileStrategy::kLazy &&
+        tiers.baseline_tier < tiers.top_tier) {
+      top_tier_units.emplace_back(callee_index, tiers.top_tier, kNoDebugging);
+    }
+  }
+  if (baseline_units.empty()) return;
+  TRACE_LAZY("Queueing %zu callees of wasm-function#%d.\n",
+             baseline_units.size(), func_index);
+  compilation_state->CommitCompilationUnits(base::VectorOf(baseline_units),
+                                            base::VectorOf(top_tier_units), {});
+}
+
 }  // namespace
 
 bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
@@ -1240,6 +1312,10 @@ bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
     compilation_state->CommitTopTierCompilationUnit(tiering_unit);
   }
 
+  if (FLAG_wasm_lazy_compile_callees) {
+    CompileLazyCalleesInBackground(native_module, func_index);
+  }
+
   return true;
 }
 
@@ -3487,6 +3563,18 @@ void CompilationStateImpl::CommitTopTierCompilationUnit(
   CommitCompilationUnits({}, {&unit, 1}, {});
 }
 
+bool CompilationStateImpl::MarkSpeculativelyQueued(int declared_func_index) {
+  base::MutexGuard guard(&mutex_);
+  if (speculatively_queued_.empty()) {
+    speculatively_queued_.resize(
+        native_module_->module()->num_declared_functions);
+  }
+  DCHECK_LT(declared_func_index, speculatively_queued_.size());
+  if (speculatively_queued_[declared_func_index]) return false;
+  speculatively_queued_[declared_func_index] = true;
+  return true;
+}
+
 void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
     WasmCompilationUnit unit, size_t priority) {
   compilation_unit_queues_.AddTopTierPriorityUnit(unit, priority);
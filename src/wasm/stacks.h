@@ -47,7 +47,7 @@ class StackMemory {
       PrintF("Delete stack #%d\n", id_);
     }
     PageAllocator* allocator = GetPlatformPageAllocator();
-    if (owned_) allocator->DecommitPages(limit_, size_);
+    if (owned_) FreePages(allocator, limit_, size_);
     // We don't need to handle removing the last stack from the list (next_ ==
     // this). This only happens on isolate tear down, otherwise there is always
     // at least one reachable stack (the active stack).
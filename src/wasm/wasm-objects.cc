@@ -1002,9 +1002,11 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
   // To avoid overall quadratic complexity of many small grow operations, we
   // grow by at least 0.5 MB + 12.5% of the existing memory size.
   // These numbers are kept small because we must be careful about address
-  // space consumption on 32-bit platforms.
+  // space consumption on 32-bit platforms. Never reserve more than the
+  // declared maximum, since the memory can't grow past it anyway.
   size_t min_growth = old_pages + 8 + (old_pages >> 3);
-  size_t new_capacity = std::max(new_pages, min_growth);
+  size_t new_capacity =
+      std::min(std::max(new_pages, min_growth), size_t{max_pages});
   std::unique_ptr<BackingStore> new_backing_store =
       backing_store->CopyWasmMemory(isolate, new_pages, new_capacity);
   if (!new_backing_store) {
@@ -16,7 +16,9 @@
 #include "src/handles/handles.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/contexts.h"
+#include "src/objects/js-collection-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/ordered-hash-table-inl.h"
 #include "src/objects/script.h"
 
 namespace v8 {
@@ -219,6 +221,7 @@ WebSnapshotSerializer::WebSnapshotSerializer(Isolate* isolate)
       function_serializer_(isolate_, nullptr),
       class_serializer_(isolate_, nullptr),
       array_serializer_(isolate_, nullptr),
+      collection_serializer_(isolate_, nullptr),
       object_serializer_(isolate_, nullptr),
       export_serializer_(isolate_, nullptr),
       external_object_ids_(isolate_->heap()),
@@ -229,6 +232,7 @@ WebSnapshotSerializer::WebSnapshotSerializer(Isolate* isolate)
       function_ids_(isolate_->heap()),
       class_ids_(isolate_->heap()),
       array_ids_(isolate_->heap()),
+      collection_ids_(isolate_->heap()),
       object_ids_(isolate_->heap()),
       builtin_object_to_name_(isolate_->heap()),
       builtin_object_ids_(isolate_->heap()),
@@ -241,6 +245,7 @@ WebSnapshotSerializer::WebSnapshotSerializer(Isolate* isolate)
   functions_ = empty_array_list;
   classes_ = empty_array_list;
   arrays_ = empty_array_list;
+  collections_ = empty_array_list;
   objects_ = empty_array_list;
 }
 
@@ -385,6 +390,11 @@ void WebSnapshotSerializer::SerializePendingItems() {
     Handle<JSArray> array = handle(JSArray::cast(arrays_->Get(i)), isolate_);
     SerializeArray(array);
   }
+  for (int i = collections_->Length() - 1; i >= 0; --i) {
+    Handle<JSCollection> collection =
+        handle(JSCollection::cast(collections_->Get(i)), isolate_);
+    SerializeCollection(collection);
+  }
   for (int i = objects_->Length() - 1; i >= 0; --i) {
     Handle<JSObject> object =
         handle(JSObject::cast(objects_->Get(i)), isolate_);
@@ -412,6 +422,12 @@ void WebSnapshotSerializer::SerializePendingItems() {
 // - Function count
 // - For each function:
 //   - Serialized function
+// - Array count
+// - For each array:
+//   - Serialized array
+// - Collection count
+// - For each collection:
+//   - Serialized collection
 // - Object count
 // - For each object:
 //   - Serialized object
@@ -432,8 +448,8 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
       builtin_object_serializer_.buffer_size_ + map_serializer_.buffer_size_ +
       context_serializer_.buffer_size_ + function_serializer_.buffer_size_ +
       class_serializer_.buffer_size_ + array_serializer_.buffer_size_ +
-      object_serializer_.buffer_size_ + export_serializer_.buffer_size_ +
-      10 * sizeof(uint32_t);
+      collection_serializer_.buffer_size_ + object_serializer_.buffer_size_ +
+      export_serializer_.buffer_size_ + 11 * sizeof(uint32_t);
   if (total_serializer.ExpandBuffer(needed_size).IsNothing()) {
     Throw("Out of memory");
     return;
@@ -450,6 +466,8 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
   WriteObjects(total_serializer, function_count(), function_serializer_,
                "functions");
   WriteObjects(total_serializer, array_count(), array_serializer_, "arrays");
+  WriteObjects(total_serializer, collection_count(), collection_serializer_,
+               "collections");
   WriteObjects(total_serializer, object_count(), object_serializer_, "objects");
   WriteObjects(total_serializer, class_count(), class_serializer_, "classes");
   WriteObjects(total_serializer, export_count_, export_serializer_, "exports");
@@ -743,6 +761,10 @@ void WebSnapshotSerializer::Discover(Handle<HeapObject> start_object) {
       case JS_ARRAY_TYPE:
         DiscoverArray(Handle<JSArray>::cast(object));
         break;
+      case JS_MAP_TYPE:
+      case JS_SET_TYPE:
+        DiscoverCollection(Handle<JSCollection>::cast(object));
+        break;
       case SYMBOL_TYPE:
         DiscoverSymbol(Handle<Symbol>::cast(object));
         break;
@@ -1042,6 +1064,50 @@ void WebSnapshotSerializer::DiscoverObjectPropertiesWithDictionaryMap(T dict) {
   }
 }
 
+void WebSnapshotSerializer::DiscoverCollection(
+    Handle<JSCollection> collection) {
+  uint32_t id;
+  if (InsertIntoIndexMap(collection_ids_, *collection, id)) {
+    return;
+  }
+  DCHECK_EQ(id, collections_->Length());
+  collections_ = ArrayList::Add(isolate_, collections_, collection);
+
+  // TODO(v8:11525): Support collections with own properties or a non-default
+  // prototype.
+  Map expected_map = collection->IsJSMap()
+                         ? isolate_->raw_native_context().js_map_map()
+                         : isolate_->raw_native_context().js_set_map();
+  if (collection->map() != expected_map) {
+    Throw("Unsupported collection");
+    return;
+  }
+
+  DisallowGarbageCollection no_gc;
+  Oddball the_hole = ReadOnlyRoots(isolate_).the_hole_value();
+  if (collection->IsJSMap()) {
+    OrderedHashMap table = OrderedHashMap::cast(collection->table());
+    for (InternalIndex entry : table.IterateEntries()) {
+      Object key = table.KeyAt(entry);
+      if (key == the_hole) continue;
+      Object value = table.ValueAt(entry);
+      if (key.IsHeapObject()) {
+        discovery_queue_.push(handle(HeapObject::cast(key), isolate_));
+      }
+      if (value.IsHeapObject()) {
+        discovery_queue_.push(handle(HeapObject::cast(value), isolate_));
+      }
+    }
+  } else {
+    OrderedHashSet table = OrderedHashSet::cast(collection->table());
+    for (InternalIndex entry : table.IterateEntries()) {
+      Object key = table.KeyAt(entry);
+      if (key == the_hole || !key.IsHeapObject()) continue;
+      discovery_queue_.push(handle(HeapObject::cast(key), isolate_));
+    }
+  }
+}
+
 void WebSnapshotSerializer::DiscoverObject(Handle<JSObject> object) {
   if (GetExternalId(*object)) {
     return;
@@ -1415,6 +1481,57 @@ void WebSnapshotSerializer::SerializeArray(Handle<JSArray> array) {
   }
 }
 
+// Format (serialized collection):
+// - CollectionType
+// - Length (number of serialized values; twice the element count for maps)
+// - For each entry:
+//   - Serialized key
+//   - Serialized value (maps only)
+void WebSnapshotSerializer::SerializeCollection(
+    Handle<JSCollection> collection) {
+  // First copy the entries, since WriteValue may allocate.
+  Handle<FixedArray> entries;
+  if (collection->IsJSMap()) {
+    collection_serializer_.WriteUint32(CollectionType::kMap);
+    Handle<OrderedHashMap> table(OrderedHashMap::cast(collection->table()),
+                                 isolate_);
+    entries = factory()->NewFixedArray(table->NumberOfElements() * 2);
+    DisallowGarbageCollection no_gc;
+    OrderedHashMap raw_table = *table;
+    FixedArray raw_entries = *entries;
+    Oddball the_hole = ReadOnlyRoots(isolate_).the_hole_value();
+    int result_index = 0;
+    for (InternalIndex entry : raw_table.IterateEntries()) {
+      Object key = raw_table.KeyAt(entry);
+      if (key == the_hole) continue;
+      raw_entries.set(result_index++, key);
+      raw_entries.set(result_index++, raw_table.ValueAt(entry));
+    }
+    DCHECK_EQ(result_index, raw_entries.length());
+  } else {
+    collection_serializer_.WriteUint32(CollectionType::kSet);
+    Handle<OrderedHashSet> table(OrderedHashSet::cast(collection->table()),
+                                 isolate_);
+    entries = factory()->NewFixedArray(table->NumberOfElements());
+    DisallowGarbageCollection no_gc;
+    OrderedHashSet raw_table = *table;
+    FixedArray raw_entries = *entries;
+    Oddball the_hole = ReadOnlyRoots(isolate_).the_hole_value();
+    int result_index = 0;
+    for (InternalIndex entry : raw_table.IterateEntries()) {
+      Object key = raw_table.KeyAt(entry);
+      if (key == the_hole) continue;
+      raw_entries.set(result_index++, key);
+    }
+    DCHECK_EQ(result_index, raw_entries.length());
+  }
+
+  collection_serializer_.WriteUint32(static_cast<uint32_t>(entries->length()));
+  for (int i = 0; i < entries->length(); ++i) {
+    WriteValue(handle(entries->get(i), isolate_), collection_serializer_);
+  }
+}
+
 // Format (serialized export):
 // - String id (export name)
 // - Serialized value (export value)
@@ -1500,6 +1617,12 @@ void WebSnapshotSerializer::WriteValue(Handle<Object> object,
       serializer.WriteUint32(ValueType::ARRAY_ID);
       serializer.WriteUint32(GetArrayId(JSArray::cast(*heap_object)));
       break;
+    case JS_MAP_TYPE:
+    case JS_SET_TYPE:
+      serializer.WriteUint32(ValueType::COLLECTION_ID);
+      serializer.WriteUint32(
+          GetCollectionId(JSCollection::cast(*heap_object)));
+      break;
     case SYMBOL_TYPE:
       serializer.WriteUint32(ValueType::SYMBOL_ID);
       serializer.WriteUint32(GetSymbolId(Symbol::cast(*heap_object)));
@@ -1615,6 +1738,14 @@ uint32_t WebSnapshotSerializer::GetArrayId(JSArray array) {
   return static_cast<uint32_t>(array_ids_.size() - 1 - id);
 }
 
+uint32_t WebSnapshotSerializer::GetCollectionId(JSCollection collection) {
+  int id;
+  bool return_value = collection_ids_.Lookup(collection, &id);
+  DCHECK(return_value);
+  USE(return_value);
+  return static_cast<uint32_t>(collection_ids_.size() - 1 - id);
+}
+
 uint32_t WebSnapshotSerializer::GetObjectId(JSObject object) {
   int id;
   bool return_value = object_ids_.Lookup(object, &id);
@@ -1680,6 +1811,8 @@ WebSnapshotDeserializer::WebSnapshotDeserializer(
   functions_handle_ = empty_array;
   classes_handle_ = empty_array;
   arrays_handle_ = empty_array;
+  collections_handle_ = empty_array;
+  collection_entries_handle_ = empty_array;
   objects_handle_ = empty_array;
   external_references_handle_ = empty_array;
   isolate_->heap()->AddGCEpilogueCallback(UpdatePointersCallback,
@@ -1699,6 +1832,7 @@ void WebSnapshotDeserializer::UpdatePointers() {
   functions_ = *functions_handle_;
   classes_ = *classes_handle_;
   arrays_ = *arrays_handle_;
+  collections_ = *collections_handle_;
   objects_ = *objects_handle_;
   external_references_ = *external_references_handle_;
 }
@@ -1827,9 +1961,11 @@ bool WebSnapshotDeserializer::DeserializeSnapshot(bool skip_exports) {
   DeserializeContexts();
   DeserializeFunctions();
   DeserializeArrays();
+  DeserializeCollections();
   DeserializeObjects();
   DeserializeClasses();
   ProcessDeferredReferences();
+  PopulateCollections();
   DeserializeExports(skip_exports);
   DCHECK_EQ(0, deferred_references_->Length());
 
@@ -2677,6 +2813,21 @@ WebSnapshotDeserializer::ArrayType WebSnapshotDeserializer::ReadArrayType() {
   return static_cast<ArrayType>(array_type);
 }
 
+WebSnapshotDeserializer::CollectionType
+WebSnapshotDeserializer::ReadCollectionType() {
+  uint32_t collection_type;
+  if (!deserializer_.ReadUint32(&collection_type)) {
+    Throw("Malformed collection type");
+    return CollectionType::kMap;
+  }
+  if (collection_type != CollectionType::kMap &&
+      collection_type != CollectionType::kSet) {
+    Throw("Unknown collection type");
+    return CollectionType::kMap;
+  }
+  return static_cast<CollectionType>(collection_type);
+}
+
 Handle<JSArray> WebSnapshotDeserializer::ReadDenseArrayElements(
     uint32_t length) {
   Handle<FixedArray> elements = factory()->NewFixedArray(length);
@@ -2787,6 +2938,87 @@ void WebSnapshotDeserializer::DeserializeArrays() {
   }
 }
 
+void WebSnapshotDeserializer::DeserializeCollections() {
+  RCS_SCOPE(isolate_,
+            RuntimeCallCounterId::kWebSnapshotDeserialize_Collections);
+  if (!deserializer_.ReadUint32(&collection_count_) ||
+      collection_count_ > kMaxItemCount) {
+    Throw("Malformed collection table");
+    return;
+  }
+  static_assert(kMaxItemCount <= FixedArray::kMaxLength);
+  collections_handle_ = factory()->NewFixedArray(collection_count_);
+  collections_ = *collections_handle_;
+  collection_entries_handle_ = factory()->NewFixedArray(collection_count_);
+  for (; current_collection_count_ < collection_count_;
+       ++current_collection_count_) {
+    CollectionType collection_type = ReadCollectionType();
+    uint32_t length;
+    if (!deserializer_.ReadUint32(&length) || length > kMaxItemCount ||
+        (collection_type == CollectionType::kMap && length % 2 != 0)) {
+      Throw("Malformed collection");
+      return;
+    }
+
+    Handle<JSCollection> collection;
+    if (collection_type == CollectionType::kMap) {
+      collection = factory()->NewJSMap();
+    } else {
+      collection = factory()->NewJSSet();
+    }
+    // The entries may contain deferred references, so they're read into a
+    // FixedArray and added to the collection in PopulateCollections.
+    Handle<FixedArray> entries = factory()->NewFixedArray(length);
+    for (uint32_t i = 0; i < length; ++i) {
+      Object value = std::get<0>(ReadValue(entries, i));
+      DisallowGarbageCollection no_gc;
+      entries->set(static_cast<int>(i), value);
+    }
+    collections_.set(static_cast<int>(current_collection_count_),
+                     *collection);
+    collection_entries_handle_->set(static_cast<int>(current_collection_count_),
+                                    *entries);
+  }
+}
+
+void WebSnapshotDeserializer::PopulateCollections() {
+  if (has_error()) return;
+  for (uint32_t i = 0; i < collection_count_; ++i) {
+    Handle<JSCollection> collection(
+        JSCollection::cast(collections_.get(static_cast<int>(i))), isolate_);
+    Handle<FixedArray> entries(
+        FixedArray::cast(collection_entries_handle_->get(static_cast<int>(i))),
+        isolate_);
+    if (collection->IsJSMap()) {
+      Handle<OrderedHashMap> table(OrderedHashMap::cast(collection->table()),
+                                   isolate_);
+      for (int j = 0; j < entries->length(); j += 2) {
+        if (!OrderedHashMap::Add(isolate_, table,
+                                 handle(entries->get(j), isolate_),
+                                 handle(entries->get(j + 1), isolate_))
+                 .ToHandle(&table)) {
+          Throw("Can't populate Map");
+          return;
+        }
+      }
+      collection->set_table(*table);
+    } else {
+      Handle<OrderedHashSet> table(OrderedHashSet::cast(collection->table()),
+                                   isolate_);
+      for (int j = 0; j < entries->length(); ++j) {
+        if (!OrderedHashSet::Add(isolate_, table,
+                                 handle(entries->get(j), isolate_))
+                 .ToHandle(&table)) {
+          Throw("Can't populate Set");
+          return;
+        }
+      }
+      collection->set_table(*table);
+    }
+  }
+  collection_entries_handle_ = factory()->empty_fixed_array();
+}
+
 void WebSnapshotDeserializer::DeserializeExports(bool skip_exports) {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize_Exports);
   uint32_t count;
@@ -2896,6 +3128,8 @@ std::tuple<Object, bool> WebSnapshotDeserializer::ReadValue(
       return std::make_tuple(ReadString(internalize_strings), false);
     case ValueType::ARRAY_ID:
       return ReadArray(container, container_index);
+    case ValueType::COLLECTION_ID:
+      return ReadCollection(container, container_index);
     case ValueType::OBJECT_ID:
       return ReadObject(container, container_index);
     case ValueType::FUNCTION_ID:
@@ -2952,6 +3186,23 @@ std::tuple<Object, bool> WebSnapshotDeserializer::ReadArray(
       AddDeferredReference(container, index, ARRAY_ID, array_id), true);
 }
 
+std::tuple<Object, bool> WebSnapshotDeserializer::ReadCollection(
+    Handle<HeapObject> container, uint32_t index) {
+  uint32_t collection_id;
+  if (!deserializer_.ReadUint32(&collection_id) ||
+      collection_id >= kMaxItemCount) {
+    Throw("Malformed variable");
+    return std::make_tuple(Smi::zero(), false);
+  }
+  if (collection_id < current_collection_count_) {
+    return std::make_tuple(collections_.get(collection_id), false);
+  }
+  // The collection hasn't been deserialized yet.
+  return std::make_tuple(
+      AddDeferredReference(container, index, COLLECTION_ID, collection_id),
+      true);
+}
+
 std::tuple<Object, bool> WebSnapshotDeserializer::ReadObject(
     Handle<HeapObject> container, uint32_t index) {
   uint32_t object_id;
@@ -3085,6 +3336,9 @@ HeapObject WebSnapshotDeserializer::AddDeferredReference(
       case ARRAY_ID:
         message = "Invalid array reference";
         break;
+      case COLLECTION_ID:
+        message = "Invalid collection reference";
+        break;
       case OBJECT_ID:
         message = "Invalid object reference";
         break;
@@ -3154,6 +3408,14 @@ void WebSnapshotDeserializer::ProcessDeferredReferences() {
         }
         target = arrays_.get(target_index);
         break;
+      case COLLECTION_ID:
+        if (static_cast<uint32_t>(target_index) >= collection_count_) {
+          AllowGarbageCollection allow_gc;
+          Throw("Invalid collection reference");
+          return;
+        }
+        target = collections_.get(target_index);
+        break;
       case OBJECT_ID:
         if (static_cast<uint32_t>(target_index) >= object_count_) {
           AllowGarbageCollection allow_gc;
@@ -58,7 +58,8 @@ class WebSnapshotSerializerDeserializer {
     SYMBOL_ID,
     EXTERNAL_ID,
     BUILTIN_OBJECT_ID,
-    IN_PLACE_STRING_ID
+    IN_PLACE_STRING_ID,
+    COLLECTION_ID
   };
 
   enum SymbolType : uint8_t {
@@ -69,6 +70,8 @@ class WebSnapshotSerializerDeserializer {
 
   enum ArrayType : uint8_t { kDense = 0, kSparse = 1 };
 
+  enum CollectionType : uint8_t { kMap = 0, kSet = 1 };
+
   static constexpr uint8_t kMagicNumber[4] = {'+', '+', '+', ';'};
 
   enum ContextType : uint8_t { FUNCTION, BLOCK };
@@ -173,6 +176,10 @@ class V8_EXPORT WebSnapshotSerializer
     return static_cast<uint32_t>(array_ids_.size());
   }
 
+  uint32_t collection_count() const {
+    return static_cast<uint32_t>(collection_ids_.size());
+  }
+
   uint32_t object_count() const {
     return static_cast<uint32_t>(object_ids_.size());
   }
@@ -213,6 +220,7 @@ class V8_EXPORT WebSnapshotSerializer
   void DiscoverContextAndPrototype(Handle<JSFunction> function);
   void DiscoverContext(Handle<Context> context);
   void DiscoverArray(Handle<JSArray> array);
+  void DiscoverCollection(Handle<JSCollection> collection);
   void DiscoverObject(Handle<JSObject> object);
   bool DiscoverIfBuiltinObject(Handle<HeapObject> object);
   void DiscoverSource(Handle<JSFunction> function);
@@ -235,6 +243,7 @@ class V8_EXPORT WebSnapshotSerializer
   void SerializeClass(Handle<JSFunction> function);
   void SerializeContext(Handle<Context> context);
   void SerializeArray(Handle<JSArray> array);
+  void SerializeCollection(Handle<JSCollection> collection);
   void SerializeObject(Handle<JSObject> object);
 
   void SerializeExport(Handle<Object> object, Handle<String> export_name);
@@ -250,6 +259,7 @@ class V8_EXPORT WebSnapshotSerializer
   uint32_t GetClassId(JSFunction function);
   uint32_t GetContextId(Context context);
   uint32_t GetArrayId(JSArray array);
+  uint32_t GetCollectionId(JSCollection collection);
   uint32_t GetObjectId(JSObject object);
   bool GetExternalId(HeapObject object, uint32_t* id = nullptr);
   // Returns index into builtin_object_name_strings_.
@@ -264,6 +274,7 @@ class V8_EXPORT WebSnapshotSerializer
   ValueSerializer function_serializer_;
   ValueSerializer class_serializer_;
   ValueSerializer array_serializer_;
+  ValueSerializer collection_serializer_;
   ValueSerializer object_serializer_;
   ValueSerializer export_serializer_;
 
@@ -275,6 +286,7 @@ class V8_EXPORT WebSnapshotSerializer
   Handle<ArrayList> functions_;
   Handle<ArrayList> classes_;
   Handle<ArrayList> arrays_;
+  Handle<ArrayList> collections_;
   Handle<ArrayList> objects_;
 
   // IndexMap to keep track of explicitly blocked external objects and
@@ -292,6 +304,7 @@ class V8_EXPORT WebSnapshotSerializer
   ObjectCacheIndexMap function_ids_;
   ObjectCacheIndexMap class_ids_;
   ObjectCacheIndexMap array_ids_;
+  ObjectCacheIndexMap collection_ids_;
   ObjectCacheIndexMap object_ids_;
   uint32_t export_count_ = 0;
 
@@ -355,6 +368,7 @@ class V8_EXPORT WebSnapshotDeserializer
   uint32_t function_count() const { return function_count_; }
   uint32_t class_count() const { return class_count_; }
   uint32_t array_count() const { return array_count_; }
+  uint32_t collection_count() const { return collection_count_; }
   uint32_t object_count() const { return object_count_; }
 
   static void UpdatePointersCallback(v8::Isolate* isolate, v8::GCType type,
@@ -399,6 +413,8 @@ class V8_EXPORT WebSnapshotDeserializer
   void DeserializeFunctions();
   void DeserializeClasses();
   void DeserializeArrays();
+  void DeserializeCollections();
+  void PopulateCollections();
   void DeserializeObjects();
   void DeserializeExports(bool skip_exports);
   void DeserializeObjectPrototype(Handle<Map> map);
@@ -424,6 +440,8 @@ class V8_EXPORT WebSnapshotDeserializer
   Object ReadSymbol();
   std::tuple<Object, bool> ReadArray(Handle<HeapObject> container,
                                      uint32_t container_index);
+  std::tuple<Object, bool> ReadCollection(Handle<HeapObject> container,
+                                          uint32_t container_index);
   std::tuple<Object, bool> ReadObject(Handle<HeapObject> container,
                                       uint32_t container_index);
   std::tuple<Object, bool> ReadFunction(Handle<HeapObject> container,
@@ -435,6 +453,7 @@ class V8_EXPORT WebSnapshotDeserializer
   Object ReadExternalReference();
   bool ReadMapType();
   ArrayType ReadArrayType();
+  CollectionType ReadCollectionType();
   Handle<JSArray> ReadDenseArrayElements(uint32_t length);
   Handle<JSArray> ReadSparseArrayElements(uint32_t length);
 
@@ -472,6 +491,14 @@ class V8_EXPORT WebSnapshotDeserializer
   Handle<FixedArray> arrays_handle_;
   FixedArray arrays_;
 
+  Handle<FixedArray> collections_handle_;
+  FixedArray collections_;
+
+  // The entries of each collection, in the same order as collections_. The
+  // entries are added to the collections only after the deferred references
+  // have been processed, since the keys need to be final for hashing.
+  Handle<FixedArray> collection_entries_handle_;
+
   Handle<FixedArray> objects_handle_;
   FixedArray objects_;
 
@@ -504,6 +531,8 @@ class V8_EXPORT WebSnapshotDeserializer
   uint32_t current_class_count_ = 0;
   uint32_t array_count_ = 0;
   uint32_t current_array_count_ = 0;
+  uint32_t collection_count_ = 0;
+  uint32_t current_collection_count_ = 0;
   uint32_t object_count_ = 0;
   uint32_t current_object_count_ = 0;
 
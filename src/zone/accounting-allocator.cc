@@ -10,6 +10,7 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -68,7 +69,8 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
 }  // namespace
 
 AccountingAllocator::AccountingAllocator()
-    : zone_backing_malloc_(
+    : max_pooled_bytes_(static_cast<size_t>(FLAG_zone_segment_pool_size) * KB),
+      zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
       zone_backing_free_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()) {
@@ -81,18 +83,79 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+// static
+int AccountingAllocator::SegmentSizeClassFor(size_t bytes) {
+  if (bytes > kMaxPooledSegmentSize) return -1;
+  int size_class = 0;
+  while (SizeOfSegmentClass(size_class) < bytes) ++size_class;
+  DCHECK_LT(size_class, kNumberOfSegmentSizeClasses);
+  return size_class;
+}
+
+Segment* AccountingAllocator::TakePooledSegment(int size_class) {
+  base::MutexGuard guard(&pool_mutex_);
+  Segment* segment = pooled_segments_[size_class];
+  if (segment == nullptr) return nullptr;
+  pooled_segments_[size_class] = segment->next();
+  pooled_bytes_.fetch_sub(segment->total_size(), std::memory_order_relaxed);
+  return segment;
+}
+
+bool AccountingAllocator::TryPoolSegment(Segment* segment) {
+  size_t segment_size = segment->total_size();
+  int size_class = SegmentSizeClassFor(segment_size);
+  if (size_class < 0 || SizeOfSegmentClass(size_class) != segment_size) {
+    return false;
+  }
+  base::MutexGuard guard(&pool_mutex_);
+  if (pooled_bytes_.load(std::memory_order_relaxed) + segment_size >
+      max_pooled_bytes_) {
+    return false;
+  }
+  segment->set_zone(nullptr);
+  segment->set_next(pooled_segments_[size_class]);
+  pooled_segments_[size_class] = segment;
+  pooled_bytes_.fetch_add(segment_size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* segments[kNumberOfSegmentSizeClasses];
+  {
+    base::MutexGuard guard(&pool_mutex_);
+    for (int i = 0; i < kNumberOfSegmentSizeClasses; ++i) {
+      segments[i] = pooled_segments_[i];
+      pooled_segments_[i] = nullptr;
+    }
+    pooled_bytes_.store(0, std::memory_order_relaxed);
+  }
+  for (Segment* segment : segments) {
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      segment->ZapHeader();
+      zone_backing_free_(segment);
+      segment = next;
+    }
+  }
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
+  void* memory = nullptr;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
-    memory = AllocWithRetry(bytes, zone_backing_malloc_);
+    int size_class = max_pooled_bytes_ > 0 ? SegmentSizeClassFor(bytes) : -1;
+    if (size_class >= 0) {
+      bytes = SizeOfSegmentClass(size_class);
+      memory = TakePooledSegment(size_class);
+    }
+    if (memory == nullptr) memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
   if (memory == nullptr) return nullptr;
 
@@ -112,10 +175,11 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
+  } else if (max_pooled_bytes_ == 0 || !TryPoolSegment(segment)) {
+    segment->ZapHeader();
     zone_backing_free_(segment);
   }
 }
@@ -10,6 +10,8 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +48,14 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Frees all segments held by the segment pool.
+  void ReleasePooledSegments();
+
+  // Number of bytes of returned segments currently kept for reuse.
+  size_t GetPooledMemory() const {
+    return pooled_bytes_.load(std::memory_order_relaxed);
+  }
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,9 +77,35 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments of [kMinPooledSegmentSize, kMaxPooledSegmentSize] bytes are
+  // rounded up to the next power of two and, when returned, are kept in a
+  // per-size-class pool of up to --zone-segment-pool-size KB so that the next
+  // compilation job can reuse them without going through malloc and free.
+  // Compressed zone segments are never pooled.
+  static constexpr size_t kMinPooledSegmentSize = 8 * KB;
+  static constexpr size_t kMaxPooledSegmentSize = 32 * KB;
+  static constexpr int kNumberOfSegmentSizeClasses = 3;
+
+  // Returns the size class for {bytes}, or -1 if {bytes} is not pooled.
+  static int SegmentSizeClassFor(size_t bytes);
+  static size_t SizeOfSegmentClass(int size_class) {
+    return kMinPooledSegmentSize << size_class;
+  }
+
+  // Pops a pooled segment of the given size class, or returns nullptr.
+  Segment* TakePooledSegment(int size_class);
+  // Pushes {segment} onto the pool. Returns false if the pool is full.
+  bool TryPoolSegment(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  const size_t max_pooled_bytes_;
+  base::Mutex pool_mutex_;
+  // Singly linked through Segment::next.
+  Segment* pooled_segments_[kNumberOfSegmentSizeClasses] = {};
+  std::atomic<size_t> pooled_bytes_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
@@ -48,6 +48,40 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+template <size_t Size>
+class SizedObject final : public GarbageCollected<SizedObject<Size>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[Size];
+};
+
+BENCHMARK_F(Allocate, MixedSizes)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  auto& allocation_handle = heap().GetAllocationHandle();
+  for (auto _ : st) {
+    USE(_);
+    // Roughly follows the size distribution of embedder heaps: mostly small
+    // objects with the occasional medium-sized one that is served from a
+    // different size class.
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<SizedObject<16>>(allocation_handle));
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<SizedObject<32>>(allocation_handle));
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<SizedObject<16>>(allocation_handle));
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<SizedObject<64>>(allocation_handle));
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<SizedObject<256>>(allocation_handle));
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<SizedObject<2048>>(allocation_handle));
+  }
+  st.SetBytesProcessed(st.iterations() *
+                       (2 * sizeof(SizedObject<16>) + sizeof(SizedObject<32>) +
+                        sizeof(SizedObject<64>) + sizeof(SizedObject<256>) +
+                        sizeof(SizedObject<2048>)));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
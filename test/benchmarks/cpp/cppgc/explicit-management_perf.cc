@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/explicit-management.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/heap-consistency.h"
+#include "include/cppgc/persistent.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using ExplicitManagement = testing::BenchmarkWithHeap;
+
+class GCed final : public GarbageCollected<GCed> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[32];
+};
+
+BENCHMARK_F(ExplicitManagement, AllocateAndFree)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  auto& allocation_handle = heap().GetAllocationHandle();
+  for (auto _ : st) {
+    USE(_);
+    auto* object = MakeGarbageCollected<GCed>(allocation_handle);
+    benchmark::DoNotOptimize(object);
+    subtle::FreeUnreferencedObject(heap().GetHeapHandle(), *object);
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(GCed));
+}
+
+BENCHMARK_F(ExplicitManagement, FreeToFreeList)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  auto& allocation_handle = heap().GetAllocationHandle();
+  for (auto _ : st) {
+    USE(_);
+    // Freeing the older object cannot return memory to the linear allocation
+    // buffer and goes through the free list instead.
+    auto* first = MakeGarbageCollected<GCed>(allocation_handle);
+    auto* second = MakeGarbageCollected<GCed>(allocation_handle);
+    benchmark::DoNotOptimize(second);
+    subtle::FreeUnreferencedObject(heap().GetHeapHandle(), *first);
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(GCed));
+}
+
+BENCHMARK_F(ExplicitManagement, Resize)(benchmark::State& st) {
+  static constexpr size_t kDelta = 64;
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  Persistent<GCed> object(MakeGarbageCollected<GCed>(
+      heap().GetAllocationHandle(), AdditionalBytes(kDelta)));
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(subtle::Resize(*object, AdditionalBytes(0)));
+    benchmark::DoNotOptimize(subtle::Resize(*object, AdditionalBytes(kDelta)));
+  }
+  st.SetBytesProcessed(st.iterations() * 2 * kDelta);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,118 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "include/cppgc/prefinalizer.h"
+#include "include/cppgc/visitor.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/stats-collector.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using GC = testing::BenchmarkWithHeap;
+using Config = GarbageCollector::Config;
+
+constexpr size_t kTreeDepth = 16;
+constexpr size_t kNumberOfGarbageObjects = size_t{1} << kTreeDepth;
+
+class TreeNode final : public GarbageCollected<TreeNode> {
+ public:
+  void Trace(Visitor* visitor) const {
+    visitor->Trace(left_);
+    visitor->Trace(right_);
+  }
+
+  void set_left(TreeNode* node) { left_ = node; }
+  void set_right(TreeNode* node) { right_ = node; }
+
+ private:
+  Member<TreeNode> left_;
+  Member<TreeNode> right_;
+};
+
+TreeNode* CreateTree(AllocationHandle& allocation_handle, size_t depth) {
+  auto* node = MakeGarbageCollected<TreeNode>(allocation_handle);
+  if (depth > 0) {
+    node->set_left(CreateTree(allocation_handle, depth - 1));
+    node->set_right(CreateTree(allocation_handle, depth - 1));
+  }
+  return node;
+}
+
+class GCedWithPreFinalizer final
+    : public GarbageCollected<GCedWithPreFinalizer> {
+  CPPGC_USING_PRE_FINALIZER(GCedWithPreFinalizer, PreFinalize);
+
+ public:
+  void Trace(Visitor*) const {}
+  void PreFinalize() { benchmark::DoNotOptimize(this); }
+};
+
+template <typename T>
+void AllocateGarbage(AllocationHandle& allocation_handle) {
+  for (size_t i = 0; i < kNumberOfGarbageObjects; ++i) {
+    benchmark::DoNotOptimize(MakeGarbageCollected<T>(allocation_handle));
+  }
+}
+
+// Measures marking of a live object graph with concurrent markers. Sweeping
+// finds nothing to reclaim.
+BENCHMARK_F(GC, ConcurrentMarking)(benchmark::State& st) {
+  static constexpr Config kConfig = {
+      Config::CollectionType::kMajor, Config::StackState::kNoHeapPointers,
+      Config::MarkingType::kIncrementalAndConcurrent,
+      Config::SweepingType::kAtomic};
+  Heap& internal_heap = *Heap::From(&heap());
+  Persistent<TreeNode> tree(
+      CreateTree(heap().GetAllocationHandle(), kTreeDepth));
+  size_t marked_bytes = 0;
+  for (auto _ : st) {
+    USE(_);
+    internal_heap.StartIncrementalGarbageCollection(kConfig);
+    internal_heap.FinalizeIncrementalGarbageCollectionIfRunning(kConfig);
+    marked_bytes += internal_heap.stats_collector()->marked_bytes();
+  }
+  st.SetBytesProcessed(marked_bytes);
+}
+
+// Measures a GC that reclaims only dead objects, i.e., is dominated by
+// sweeping.
+BENCHMARK_F(GC, Sweeping)(benchmark::State& st) {
+  Heap& internal_heap = *Heap::From(&heap());
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    AllocateGarbage<TreeNode>(heap().GetAllocationHandle());
+    st.ResumeTiming();
+    internal_heap.CollectGarbage(Config::PreciseAtomicConfig());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfGarbageObjects);
+}
+
+// Same as above but with dead objects that all have pre-finalizers that need
+// to be invoked during the atomic pause.
+BENCHMARK_F(GC, PreFinalizers)(benchmark::State& st) {
+  Heap& internal_heap = *Heap::From(&heap());
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    AllocateGarbage<GCedWithPreFinalizer>(heap().GetAllocationHandle());
+    st.ResumeTiming();
+    internal_heap.CollectGarbage(Config::PreciseAtomicConfig());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfGarbageObjects);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
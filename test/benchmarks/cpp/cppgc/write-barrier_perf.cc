@@ -0,0 +1,63 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "include/cppgc/visitor.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using WriteBarrier = testing::BenchmarkWithHeap;
+using Config = GarbageCollector::Config;
+
+class GCed final : public GarbageCollected<GCed> {
+ public:
+  void Trace(Visitor* visitor) const { visitor->Trace(next); }
+
+  Member<GCed> next;
+};
+
+void AssignInLoop(benchmark::State& st, GCed& holder, GCed* a, GCed* b) {
+  for (auto _ : st) {
+    USE(_);
+    holder.next = a;
+    holder.next = b;
+    benchmark::ClobberMemory();
+  }
+  st.SetItemsProcessed(st.iterations() * 2);
+}
+
+BENCHMARK_F(WriteBarrier, NotMarking)(benchmark::State& st) {
+  auto& allocation_handle = heap().GetAllocationHandle();
+  Persistent<GCed> holder(MakeGarbageCollected<GCed>(allocation_handle));
+  Persistent<GCed> a(MakeGarbageCollected<GCed>(allocation_handle));
+  Persistent<GCed> b(MakeGarbageCollected<GCed>(allocation_handle));
+  AssignInLoop(st, *holder, a.Get(), b.Get());
+}
+
+BENCHMARK_F(WriteBarrier, IncrementalMarking)(benchmark::State& st) {
+  auto& allocation_handle = heap().GetAllocationHandle();
+  Persistent<GCed> holder(MakeGarbageCollected<GCed>(allocation_handle));
+  Persistent<GCed> a(MakeGarbageCollected<GCed>(allocation_handle));
+  Persistent<GCed> b(MakeGarbageCollected<GCed>(allocation_handle));
+  Heap& internal_heap = *Heap::From(&heap());
+  internal_heap.StartIncrementalGarbageCollection(
+      Config::PreciseIncrementalConfig());
+  AssignInLoop(st, *holder, a.Get(), b.Get());
+  internal_heap.FinalizeIncrementalGarbageCollectionIfRunning(
+      Config::PreciseIncrementalConfig());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
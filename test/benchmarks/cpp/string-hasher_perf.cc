@@ -0,0 +1,46 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/base/macros.h"
+#include "src/strings/string-hasher-inl.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+constexpr uint64_t kBenchmarkSeed = 0x5eed;
+
+void BM_StringHasherOneByte(benchmark::State& state) {
+  const std::string input(static_cast<size_t>(state.range(0)), 'x');
+  const uint8_t* chars = reinterpret_cast<const uint8_t*>(input.data());
+  const int length = static_cast<int>(input.size());
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        StringHasher::HashSequentialString(chars, length, kBenchmarkSeed));
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+}
+
+BENCHMARK(BM_StringHasherOneByte)->Arg(8)->Arg(64)->Arg(1024);
+
+void BM_StringHasherArrayIndex(benchmark::State& state) {
+  const std::string input = "4294967294";
+  const uint8_t* chars = reinterpret_cast<const uint8_t*>(input.data());
+  const int length = static_cast<int>(input.size());
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        StringHasher::HashSequentialString(chars, length, kBenchmarkSeed));
+  }
+}
+
+BENCHMARK(BM_StringHasherArrayIndex);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
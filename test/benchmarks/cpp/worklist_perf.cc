@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/heap/base/worklist.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace heap {
+namespace base {
+namespace {
+
+struct SomeObject {};
+
+using BenchmarkWorklist = Worklist<SomeObject*, 64>;
+
+void BM_WorklistLocalPushPop(benchmark::State& state) {
+  const int64_t entries = state.range(0);
+  SomeObject dummy;
+  BenchmarkWorklist worklist;
+  BenchmarkWorklist::Local local(&worklist);
+  for (auto _ : state) {
+    USE(_);
+    for (int64_t i = 0; i < entries; ++i) local.Push(&dummy);
+    SomeObject* object;
+    while (local.Pop(&object)) benchmark::DoNotOptimize(object);
+  }
+  state.SetItemsProcessed(state.iterations() * entries);
+}
+
+BENCHMARK(BM_WorklistLocalPushPop)->Arg(16)->Arg(1024)->Arg(64 * 1024);
+
+void BM_WorklistPublishSteal(benchmark::State& state) {
+  const int64_t entries = state.range(0);
+  SomeObject dummy;
+  BenchmarkWorklist worklist;
+  BenchmarkWorklist::Local producer(&worklist);
+  BenchmarkWorklist::Local consumer(&worklist);
+  for (auto _ : state) {
+    USE(_);
+    for (int64_t i = 0; i < entries; ++i) producer.Push(&dummy);
+    producer.Publish();
+    SomeObject* object;
+    while (consumer.Pop(&object)) benchmark::DoNotOptimize(object);
+  }
+  state.SetItemsProcessed(state.iterations() * entries);
+}
+
+BENCHMARK(BM_WorklistPublishSteal)->Arg(1024)->Arg(64 * 1024);
+
+}  // namespace
+}  // namespace base
+}  // namespace heap
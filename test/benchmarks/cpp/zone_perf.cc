@@ -0,0 +1,35 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+struct ZoneBenchmarkTag;
+
+void BM_ZoneAllocate(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  constexpr int kAllocationsPerZone = 1024;
+  AccountingAllocator allocator;
+  for (auto _ : state) {
+    USE(_);
+    Zone zone(&allocator, "benchmark");
+    for (int i = 0; i < kAllocationsPerZone; ++i) {
+      benchmark::DoNotOptimize(zone.Allocate<ZoneBenchmarkTag>(size));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAllocationsPerZone);
+  state.SetBytesProcessed(state.iterations() * kAllocationsPerZone * size);
+}
+
+BENCHMARK(BM_ZoneAllocate)->Arg(8)->Arg(64)->Arg(512);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
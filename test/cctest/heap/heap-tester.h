@@ -41,6 +41,7 @@
   V(MemoryReducerActivationForSmallHeaps)                   \
   V(NoPromotion)                                            \
   V(NumberStringCacheSize)                                  \
+  V(NumberStringCacheSizeLimit)                             \
   V(ObjectGroups)                                           \
   V(Promotion)                                              \
   V(Regression39128)                                        \
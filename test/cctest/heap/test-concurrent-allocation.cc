@@ -129,6 +129,47 @@ UNINITIALIZED_TEST(ConcurrentAllocationInOldSpaceFromMainThread) {
   isolate->Dispose();
 }
 
+UNINITIALIZED_TEST(ConcurrentAllocationAdaptsLabSize) {
+  FLAG_max_old_space_size = 32;
+  FLAG_stress_concurrent_allocation = false;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+
+  {
+    LocalHeap local_heap(i_isolate->heap(), ThreadKind::kBackground);
+    UnparkedScope unparked_scope(&local_heap);
+    ConcurrentAllocator* allocator = local_heap.old_space_allocator();
+    CHECK_EQ(ConcurrentAllocator::kLabSize, allocator->lab_size());
+
+    // Steady allocation grows the TLAB up to its maximum size.
+    for (int i = 0; i < kNumIterations; i++) {
+      Address address = local_heap.AllocateRawOrFail(
+          kSmallObjectSize, AllocationType::kOld, AllocationOrigin::kRuntime,
+          AllocationAlignment::kTaggedAligned);
+      CreateFixedArray(i_isolate->heap(), address, kSmallObjectSize);
+    }
+    CHECK_EQ(ConcurrentAllocator::kMaxLabSize, allocator->lab_size());
+    CHECK_LT(0u, allocator->lab_refills());
+    CHECK_LE(static_cast<size_t>(kNumIterations * kSmallObjectSize),
+             allocator->lab_allocated_bytes());
+    CHECK_EQ(0u, allocator->outside_lab_allocated_bytes());
+
+    // A TLAB that is left mostly unused shrinks the next refill.
+    allocator->FreeLinearAllocationArea();
+    Address address = local_heap.AllocateRawOrFail(
+        kSmallObjectSize, AllocationType::kOld, AllocationOrigin::kRuntime,
+        AllocationAlignment::kTaggedAligned);
+    CreateFixedArray(i_isolate->heap(), address, kSmallObjectSize);
+    allocator->FreeLinearAllocationArea();
+    CHECK_LT(allocator->lab_size(), ConcurrentAllocator::kMaxLabSize);
+  }
+
+  isolate->Dispose();
+}
+
 UNINITIALIZED_TEST(ConcurrentAllocationWhileMainThreadIsParked) {
   FLAG_max_old_space_size = 4;
   FLAG_stress_concurrent_allocation = false;
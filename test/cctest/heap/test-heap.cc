@@ -1163,6 +1163,64 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOnMemoryReducingGC) {
+#ifndef V8_LITE_MODE
+  FLAG_turbofan = false;
+  FLAG_always_turbofan = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_flush_code_on_memory_reducing_gc = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+
+    // A regular GC only ages the bytecode.
+    CcTest::CollectAllGarbage();
+    CHECK(function->shared().is_compiled());
+
+    // A GC that reduces memory flushes bytecode that was not executed since
+    // the previous GC.
+    CcTest::heap()->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                                      GarbageCollectionReason::kTesting);
+    CHECK(!function->shared().is_compiled());
+    CHECK(!function->is_compiled());
+
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -5338,6 +5396,26 @@ HEAP_TEST(NumberStringCacheSize) {
            heap->number_string_cache().length());
 }
 
+HEAP_TEST(NumberStringCacheSizeLimit) {
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  const size_t min_entries = Heap::kInitialNumberStringCacheSize * 2;
+  const size_t semi_space_entries = heap->MaxSemiSpaceSize() / 512;
+  auto expected_length = [=](size_t max_entries) {
+    return static_cast<int>(
+        2 * std::max(min_entries, std::min(max_entries, semi_space_entries)));
+  };
+
+  // The flag is rounded up to a power of two and capped by the semi-space.
+  FLAG_max_number_string_cache_entries = 1000;
+  CHECK_EQ(expected_length(1024), heap->MaxNumberToStringCacheSize());
+
+  // Values too large to round up to a power of two are clamped.
+  FLAG_max_number_string_cache_entries = std::numeric_limits<unsigned>::max();
+  CHECK_EQ(expected_length(Heap::kMaxNumberStringCacheEntries),
+           heap->MaxNumberToStringCacheSize());
+}
+
 
 TEST(Regress3877) {
   CcTest::InitializeVM();
@@ -132,6 +132,48 @@ TEST_WITH_PLATFORM(IncrementalMarkingUsingTasks, MockPlatform) {
   }
 }
 
+TEST(IncrementalMarkingStepRespectsPauseBudget) {
+  if (!i::FLAG_incremental_marking) return;
+  FLAG_concurrent_marking = false;
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  v8::HandleScope handle_scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+
+  // Build a graph that is much larger than a single minimal marking step.
+  const int kOuterLength = 1024;
+  const int kInnerLength = 128;
+  Handle<FixedArray> holder =
+      factory->NewFixedArray(kOuterLength, AllocationType::kOld);
+  for (int i = 0; i < kOuterLength; i++) {
+    holder->set(i, *factory->NewFixedArray(kInnerLength, AllocationType::kOld));
+  }
+
+  i::heap::SimulateIncrementalMarking(heap, false);
+  i::IncrementalMarking* marking = heap->incremental_marking();
+  CHECK(marking->IsMarking());
+
+  CcTest::isolate()->SetGCPauseBudget(1e-6, 0);
+  const size_t bytes_marked_before = marking->bytes_marked_for_testing();
+  marking->Step(i::IncrementalMarking::kMaxStepSizeInMs,
+                i::IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+                i::StepOrigin::kV8);
+  const size_t bytes_marked =
+      marking->bytes_marked_for_testing() - bytes_marked_before;
+  CcTest::isolate()->SetGCPauseBudget(0, 0);
+
+  // The budget shrinks the step to the minimum step size, which may only be
+  // overshot by the last object visited.
+  const size_t kMinStepSizeInBytes = i::IncrementalMarking::kMinStepSizeInBytes;
+  CHECK_LE(bytes_marked,
+           kMinStepSizeInBytes + static_cast<size_t>(holder->Size()));
+  CHECK(marking->IsMarking());
+
+  CcTest::CollectAllGarbage();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
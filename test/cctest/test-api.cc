@@ -16715,6 +16715,30 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+TEST(GetHeapObjectStatisticsWithSampling) {
+  FlagScope<int> sampling_interval(
+      &i::FLAG_gc_object_stats_sampling_interval, 1);
+  LocalContext c1;
+  v8::Isolate* isolate = c1->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CompileRun("var a = []; for (var i = 0; i < 100; i++) a.push({x: i});");
+  CcTest::CollectAllGarbage();
+
+  size_t total_count = 0;
+  size_t total_size = 0;
+  for (size_t i = 0; i < isolate->NumberOfTrackedHeapObjectTypes(); ++i) {
+    v8::HeapObjectStatistics object_statistics;
+    if (!isolate->GetHeapObjectStatisticsAtLastGC(&object_statistics, i)) {
+      continue;
+    }
+    total_count += object_statistics.object_count();
+    total_size += object_statistics.object_size();
+  }
+  CHECK_LT(0u, total_count);
+  CHECK_LT(0u, total_size);
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -29,6 +29,7 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -4689,6 +4690,78 @@ TEST(SkipEstimatedSizeWhenActiveProfiling) {
   CHECK_GT(profiler.GetEstimatedMemoryUsage(), 0);
 }
 
+namespace {
+class PprofTestStream : public v8::OutputStream {
+ public:
+  void EndOfStream() override { ++eos_signaled_; }
+  int GetChunkSize() override { return 16; }
+  WriteResult WriteAsciiChunk(char* buffer, int chars_written) override {
+    UNREACHABLE();
+  }
+  WriteResult WriteBinaryChunk(const uint8_t* buffer,
+                               int bytes_written) override {
+    CHECK_GT(bytes_written, 0);
+    CHECK_LE(bytes_written, GetChunkSize());
+    data_.append(reinterpret_cast<const char*>(buffer), bytes_written);
+    return kContinue;
+  }
+  int eos_signaled() const { return eos_signaled_; }
+  const std::string& data() const { return data_; }
+
+ private:
+  int eos_signaled_ = 0;
+  std::string data_;
+};
+
+class AsciiOnlyTestStream : public v8::OutputStream {
+ public:
+  void EndOfStream() override { ++eos_signaled_; }
+  WriteResult WriteAsciiChunk(char* buffer, int chars_written) override {
+    UNREACHABLE();
+  }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  int eos_signaled_ = 0;
+};
+}  // namespace
+
+// Cutting a profile by starting the next one before stopping the current one
+// keeps the sampling processor alive, and the cut profile can be exported.
+TEST(CutProfileAndSerializeToPprof) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfiler profiler(isolate);
+
+  CpuProfilingResult first = profiler.StartProfiling("first");
+  CHECK_EQ(CpuProfilingStatus::kStarted, first.status);
+  ProfilerEventsProcessor* processor = profiler.processor();
+  CHECK_NOT_NULL(processor);
+  CompileRun("function f() { for (var i = 0; i < 1e5; i++); } f();");
+
+  CpuProfilingResult second = profiler.StartProfiling("second");
+  CHECK_EQ(CpuProfilingStatus::kStarted, second.status);
+  CpuProfile* first_profile = profiler.StopProfiling(first.id);
+  CHECK_NOT_NULL(first_profile);
+  CHECK_EQ(processor, profiler.processor());
+
+  PprofTestStream stream;
+  reinterpret_cast<v8::CpuProfile*>(first_profile)->Serialize(&stream);
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK(!stream.data().empty());
+  // The message starts with the length-delimited sample_type field (1).
+  CHECK_EQ(0x0A, stream.data()[0]);
+  CHECK_NE(std::string::npos, stream.data().find("nanoseconds"));
+
+  // Streams that only accept ASCII chunks never see the binary message.
+  AsciiOnlyTestStream ascii_stream;
+  reinterpret_cast<v8::CpuProfile*>(first_profile)->Serialize(&ascii_stream);
+  CHECK_EQ(0, ascii_stream.eos_signaled());
+
+  profiler.StopProfiling(second.id);
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
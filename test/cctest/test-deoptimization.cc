@@ -35,6 +35,7 @@
 #include "src/debug/debug.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/isolate.h"
+#include "src/execution/tiering-manager.h"
 #include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/cctest.h"
@@ -929,3 +930,56 @@ UNINITIALIZED_TEST(DeoptimizeLoadICStoreICNested) {
   isolate->Exit();
   isolate->Dispose();
 }
+
+
+UNINITIALIZED_TEST(ExpensiveTurbofanCompileBacksOffAfterDeopt) {
+  if (!i::FLAG_turbofan || i::FLAG_always_turbofan || i::FLAG_maglev) return;
+  ManualGCScope manual_gc_scope;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_concurrent_recompilation = false;
+  i::FLAG_sparkplug = false;
+  // Treat every Turbofan compile as expensive.
+  i::FLAG_expensive_turbofan_compile_ms = 0;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  isolate->Enter();
+  {
+    LocalContext env(isolate);
+    v8::HandleScope scope(env->GetIsolate());
+
+    CompileRun(
+        "function f(x) { return x + 1; };"
+        "%PrepareFunctionForOptimization(f);"
+        "f(1); f(2);"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(3);");
+    Handle<JSFunction> f = GetJSFunction(env.local(), "f");
+    CHECK(f->HasAttachedOptimizedCode());
+    CHECK(f->feedback_vector().expensive_turbofan_compile());
+    CHECK_EQ(0, f->feedback_vector().turbofan_deopt_count());
+
+    // The string argument deopts the optimized code.
+    CompileRun("f('a');");
+    CHECK(!f->HasAttachedOptimizedCode());
+    CHECK_EQ(1, f->feedback_vector().turbofan_deopt_count());
+
+    // After one deopt the tick threshold is doubled, and the small function
+    // fast path no longer applies.
+    const int ticks_for_optimization = i::FLAG_ticks_before_optimization << 1;
+    f->feedback_vector().set_profiler_ticks(0);
+    for (int i = 1; i < ticks_for_optimization; ++i) {
+      i_isolate->tiering_manager()->OnInterruptTick(f);
+      CHECK(i::IsNone(f->tiering_state()));
+    }
+    i_isolate->tiering_manager()->OnInterruptTick(f);
+    CHECK(!i::IsNone(f->tiering_state()));
+
+    // The function is optimized again on its next call.
+    CompileRun("f(4);");
+    CHECK(f->HasAttachedOptimizedCode());
+  }
+  isolate->Exit();
+  isolate->Dispose();
+}
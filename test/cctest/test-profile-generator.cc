@@ -562,6 +562,25 @@ TEST(CpuProfilesCollectionDuplicateTitle) {
   collection.StopProfiling(profile_result.id);
 }
 
+TEST(CpuProfilesCollectionDroppedSamples) {
+  CpuProfilesCollection collection(CcTest::i_isolate());
+  CpuProfiler profiler(CcTest::i_isolate());
+  collection.set_cpu_profiler(&profiler);
+
+  auto first = collection.StartProfiling("first");
+  CHECK_EQ(CpuProfilingStatus::kStarted, first.status);
+  collection.AddDroppedSamplesToCurrentProfiles(3);
+
+  auto second = collection.StartProfiling("second");
+  CHECK_EQ(CpuProfilingStatus::kStarted, second.status);
+  collection.AddDroppedSamplesToCurrentProfiles(2);
+
+  CpuProfile* first_profile = collection.StopProfiling(first.id);
+  CpuProfile* second_profile = collection.StopProfiling(second.id);
+  CHECK_EQ(5u, first_profile->dropped_samples_count());
+  CHECK_EQ(2u, second_profile->dropped_samples_count());
+}
+
 namespace {
 class DiscardedSamplesDelegateImpl : public v8::DiscardedSamplesDelegate {
  public:
@@ -1051,6 +1070,50 @@ TEST(CodeMapMoveOverlappingCode) {
   CHECK_EQ(after_entry->instruction_start(), ToAddress(0x1800));
 }
 
+// Exercises enough additions and moves to go through the batched merge of
+// pending entries into the sorted map.
+TEST(CodeMapManyEntries) {
+  CodeEntryStorage storage;
+  CodeMap code_map(storage);
+  constexpr int kEntries = 1000;
+  constexpr unsigned kSize = 0x10;
+  std::vector<CodeEntry*> entries;
+  // Add in reverse address order so that merging has to reorder entries.
+  for (int i = kEntries - 1; i >= 0; --i) {
+    CodeEntry* entry =
+        storage.Create(i::LogEventListener::FUNCTION_TAG, "aaa");
+    code_map.AddCode(ToAddress(0x10000 + i * kSize), entry, kSize);
+    entries.push_back(entry);
+  }
+  CHECK_EQ(static_cast<size_t>(kEntries), code_map.size());
+  for (int i = 0; i < kEntries; ++i) {
+    CHECK_EQ(entries[kEntries - 1 - i],
+             code_map.FindEntry(ToAddress(0x10000 + i * kSize + 1)));
+  }
+
+  // Move every entry to a new region, as compaction would.
+  for (int i = 0; i < kEntries; ++i) {
+    code_map.MoveCode(ToAddress(0x10000 + i * kSize),
+                      ToAddress(0x80000 + i * kSize));
+  }
+  CHECK_EQ(static_cast<size_t>(kEntries), code_map.size());
+  CHECK(!code_map.FindEntry(ToAddress(0x10000)));
+  for (int i = 0; i < kEntries; ++i) {
+    CHECK_EQ(entries[kEntries - 1 - i],
+             code_map.FindEntry(ToAddress(0x80000 + i * kSize)));
+  }
+
+  for (int i = 0; i < kEntries; i += 2) {
+    CHECK(code_map.RemoveCode(entries[i]));
+  }
+  CHECK_EQ(static_cast<size_t>(kEntries / 2), code_map.size());
+  for (int i = 0; i < kEntries; ++i) {
+    CodeEntry* expected = i % 2 == 0 ? nullptr : entries[i];
+    CHECK_EQ(expected, code_map.FindEntry(ToAddress(
+                           0x80000 + (kEntries - 1 - i) * kSize)));
+  }
+}
+
 }  // namespace test_profile_generator
 }  // namespace internal
 }  // namespace v8
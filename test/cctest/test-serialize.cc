@@ -2684,6 +2684,138 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_turbofan = prev_always_turbofan_value;
 }
 
+TEST(CodeSerializerTieringHint) {
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate1, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    CHECK(!sfi->was_marked_for_turbofan());
+    sfi->set_was_marked_for_turbofan(true);
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    // The hint survives the round trip through the code cache.
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    CHECK(sfi->was_marked_for_turbofan());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerPreparseData) {
+  // Lazy functions keep their preparse data through the code cache, so that
+  // compiling them after deserialization can skip their inner functions.
+  const char* js_source =
+      "function outer() {"
+      "  function inner() { return 42; }"
+      "  return inner();"
+      "}";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate1, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    Handle<JSFunction> outer = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*context->Global()
+                                   ->Get(context, v8_str("outer"))
+                                   .ToLocalChecked()));
+    CHECK(!outer->shared().is_compiled());
+    CHECK(outer->shared().HasUncompiledDataWithPreparseData());
+    CHECK_EQ(42, CompileRun("outer()")
+                     ->Int32Value(isolate2->GetCurrentContext())
+                     .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerTieringHintClearedOnDeopt) {
+  if (!FLAG_turbofan || FLAG_always_turbofan) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_code_cache_tiering_hints = true;
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  CompileRun(
+      "function f(x) { return x + 1; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1); f(2);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f(3);");
+  Handle<JSFunction> f = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*context->Global()
+                                 ->Get(context.local(), v8_str("f"))
+                                 .ToLocalChecked()));
+  CHECK(f->HasAttachedOptimizedCode());
+  f->shared().set_was_marked_for_turbofan(true);
+
+  // The string argument deopts the optimized code, which drops the hint so
+  // that a code cache created afterwards doesn't carry it.
+  CompileRun("f('a');");
+  CHECK(!f->HasAttachedOptimizedCode());
+  CHECK(!f->shared().was_marked_for_turbofan());
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -174,6 +174,34 @@ UNINITIALIZED_TEST(InPlaceInternalization) {
   CHECK_EQ(*two_byte_intern1, *two_byte_intern2);
 }
 
+UNINITIALIZED_TEST(SharedHeapStatistics) {
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  if (!COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) return;
+
+  FLAG_shared_string_table = true;
+
+  MultiClientIsolateTest test;
+  v8::Isolate* isolate1 = test.NewClientIsolate();
+  v8::Isolate* isolate2 = test.NewClientIsolate();
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  Factory* factory1 = i_isolate1->factory();
+
+  HandleScope scope(i_isolate1);
+  Handle<String> shared_string =
+      factory1->NewStringFromAsciiChecked("foo", AllocationType::kOld);
+  CHECK(shared_string->InSharedHeap());
+
+  // Both clients report the same shared heap, which contains the string
+  // allocated above.
+  v8::HeapStatistics stats1;
+  isolate1->GetHeapStatistics(&stats1);
+  v8::HeapStatistics stats2;
+  isolate2->GetHeapStatistics(&stats2);
+  CHECK_LT(0, stats1.used_shared_heap_size());
+  CHECK_LE(stats1.used_shared_heap_size(), stats1.total_shared_heap_size());
+  CHECK_EQ(stats1.total_shared_heap_size(), stats2.total_shared_heap_size());
+}
+
 UNINITIALIZED_TEST(YoungInternalization) {
   if (FLAG_single_generation) return;
   if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
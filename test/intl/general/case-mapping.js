@@ -217,3 +217,15 @@ assertEquals("\u00A0¡¢£¤¥¦§¨©ª«¬\u00AD®°±²³´µ¶·¸¹º»¼½
     "àáâãäåæçèéêëi\u0307\u0300i\u0307\u0301îïðñòóôõö×øùúûüýþß" +
     "àáâãäåæçèéêëìíîïðñòóôõö÷øùúûüýþÿ",
     latin1Suppl.toLocaleLowerCase("lt"));
+
+// Two-byte strings made of Latin-1, basic Cyrillic and uncased characters
+// take a fast path that does not call into ICU.
+var mixedTwoByte = "AbÀé ЁЖжё あ一가";
+assertEquals("abàé ёжжё あ一가", mixedTwoByte.toLowerCase());
+assertEquals("ABÀÉ ЁЖЖЁ あ一가", mixedTwoByte.toUpperCase());
+assertEquals("一丁", "一丁".toLowerCase());
+assertEquals("一丁", "一丁".toUpperCase());
+// Characters without a simple mapping fall back to the full path.
+assertEquals("ЖSSŸΜ", "жßÿµ".toUpperCase());
+assertEquals("жi̇", "Жİ".toLowerCase());
+assertEquals("жς", "ЖΣ".toLowerCase());
@@ -0,0 +1,26 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The per-isolate ICU object cache keeps several locales per cache type.
+// Alternating between them must still use the formatter of the requested
+// locale.
+
+const locales = ['en', 'de', 'fr', 'ja', 'ar', 'en'];
+const number = 1234567.891;
+const date = new Date(Date.UTC(2022, 5, 15, 12, 0, 0));
+
+const expected_number = locales.map(
+    l => new Intl.NumberFormat(l).format(number));
+const expected_date = locales.map(
+    l => new Intl.DateTimeFormat(l).format(date));
+const expected_compare = locales.map(
+    l => new Intl.Collator(l).compare('a', 'B'));
+
+for (let i = 0; i < 3; i++) {
+  locales.forEach((l, j) => {
+    assertEquals(expected_number[j], number.toLocaleString(l));
+    assertEquals(expected_date[j], date.toLocaleDateString(l));
+    assertEquals(expected_compare[j], 'a'.localeCompare('B', l));
+  });
+}
@@ -42,8 +42,17 @@ new BenchmarkSuite('LongTwoBytesSubject', [1000], [
   LongTwoBytesSubject),
 ]);
 
+new BenchmarkSuite('ShortSubjectCommaSeparatorLoop', [1000], [
+  new Benchmark('ShortSubjectCommaSeparatorLoop', true, false, 0,
+  ShortSubjectCommaSeparatorLoop),
+]);
+
 const shortString = "ababaabcdeaaaaaab";
 const shortTwoBytesString = "\u0429\u0428\u0428\u0429\u0429\u0429\u0428\u0429\u0429";
+const csvLines = [
+  "id,name,price,quantity", "1,apple,0.5,10", "2,banana,0.25,12",
+  "3,cherry,3.75,1", "4,durian,12.5,2"
+];
 // Use Array.join to create a flat string
 const longString = new Array(0x500).fill("abcde").join('');
 const longTwoBytesString = new Array(0x500).fill("\u0427\u0428\u0429\u0430").join('');
@@ -79,3 +88,11 @@ function ShortTwoBytesSubject() {
 function LongTwoBytesSubject() {
   longTwoBytesString.split('\u0428');
 }
+
+function ShortSubjectCommaSeparatorLoop() {
+  let fields = 0;
+  for (let i = 0; i < csvLines.length; ++i) {
+    fields += csvLines[i].split(',').length;
+  }
+  return fields;
+}
@@ -0,0 +1,60 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Default-order sorting of arrays that contain only Smis, which is done in
+// the runtime for large enough inputs.
+
+function referenceSort(array) {
+  return array.map(String).sort((a, b) => a < b ? -1 : a > b ? 1 : 0)
+      .map(Number);
+}
+
+function randomSmis(length, range) {
+  let result = [];
+  for (let i = 0; i < length; i++) {
+    result.push(Math.floor(Math.random() * range) - (range >> 1));
+  }
+  return result;
+}
+
+for (let length of [0, 1, 2, 63, 64, 65, 200, 1000]) {
+  for (let range of [10, 1000, 1 << 30]) {
+    let array = randomSmis(length, range);
+    let expected = referenceSort(array);
+    assertEquals(expected, array.sort());
+  }
+}
+
+// Values whose string order differs from their numeric order.
+let tricky = [];
+for (let i = 0; i < 100; i++) tricky.push(i, 0 - i, i * 10, i * 101);
+tricky.push(0x3fffffff, -0x40000000, 1073741823, 9, 90, 900, 10, 100);
+assertEquals(referenceSort(tricky), tricky.slice().sort());
+
+// Holes and undefined end up at the end.
+let holey = randomSmis(100, 1000);
+holey[150] = 7;
+holey[120] = undefined;
+let sortedHoley = holey.sort();
+assertEquals(101, sortedHoley.filter(x => x !== undefined).length);
+assertEquals(undefined, sortedHoley[101]);
+assertFalse(150 in sortedHoley);
+
+// A non-Smi element falls back to the generic sort.
+let mixed = randomSmis(100, 1000);
+mixed.push(1.5, "abc");
+let expectedMixed = referenceSort(mixed.slice(0, 100));
+assertEquals(expectedMixed, mixed.sort().filter(x => Number.isInteger(x)));
+
+// Generic receivers with Smi values.
+let object = {length: 100};
+for (let i = 0; i < 100; i++) object[i] = 99 - i;
+Array.prototype.sort.call(object);
+let expected = referenceSort(Array.from({length: 100}, (_, i) => i));
+for (let i = 0; i < 100; i++) assertEquals(expected[i], object[i]);
+
+// A comparison function is still called.
+let calls = 0;
+randomSmis(100, 1000).sort((a, b) => (calls++, a - b));
+assertTrue(calls > 0);
@@ -0,0 +1,31 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --sparkplug --no-always-sparkplug
+// Flags: --sparkplug-compact-code
+
+function run(f, ...args) {
+  try { f(...args); } catch (e) {}
+  %CompileBaseline(f);
+  return f(...args);
+}
+
+const values = [
+  0, 1.5, "", "s", Symbol(), true, false, 1n, undefined, null, {}, [],
+  () => {}, class {}, %GetUndetectable()
+];
+
+for (const v of values) {
+  assertEquals(typeof v === "number", run((x) => typeof x === "number", v));
+  assertEquals(typeof v === "string", run((x) => typeof x === "string", v));
+  assertEquals(typeof v === "symbol", run((x) => typeof x === "symbol", v));
+  assertEquals(typeof v === "boolean", run((x) => typeof x === "boolean", v));
+  assertEquals(typeof v === "bigint", run((x) => typeof x === "bigint", v));
+  assertEquals(typeof v === "undefined",
+               run((x) => typeof x === "undefined", v));
+  assertEquals(typeof v === "function",
+               run((x) => typeof x === "function", v));
+  assertEquals(typeof v === "object", run((x) => typeof x === "object", v));
+  assertFalse(run((x) => typeof x === "other", v));
+}
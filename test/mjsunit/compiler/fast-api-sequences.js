@@ -129,6 +129,15 @@ for (let i = 0; i < 100; i++) {
 // `add_all_<TYPE>_typed_array` have the following signature:
 // double add_all_<TYPE>_typed_array(bool /*should_fallback*/, FastApiTypedArray<TYPE>)
 
+(function () {
+  function uint8_test() {
+    let typed_array = new Uint8Array([1, 2, 3, 200]);
+    return fast_c_api.add_all_uint8_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(uint8_test, 206);
+})();
+
 (function () {
   function int32_test() {
     let typed_array = new Int32Array([-42, 1, 2, 3]);
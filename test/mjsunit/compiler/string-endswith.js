@@ -0,0 +1,96 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan
+
+(function() {
+  function foo(string) { return string.endsWith('c'); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(false, foo(''));
+  assertEquals(true, foo('c'));
+  assertEquals(false, foo('cb'));
+  assertEquals(true, foo('abc'));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(false, foo(''));
+  assertEquals(true, foo('c'));
+  assertEquals(false, foo('cb'));
+  assertEquals(true, foo('abc'));
+  assertOptimized(foo);
+})();
+
+(function() {
+  function f(string) { return string.endsWith('bc'); }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(false, f('c'));
+  assertEquals(true, f('bc'));
+  assertEquals(true, f('abc'));
+  assertEquals(false, f('acb'));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(false, f('c'));
+  assertEquals(true, f('bc'));
+  assertEquals(true, f('abc'));
+  assertEquals(false, f('acb'));
+  assertOptimized(f);
+})();
+
+(function() {
+  function g(n) { return "abc".endsWith("a", n); }
+
+  %PrepareFunctionForOptimization(g);
+  assertEquals(false, g(-1));
+  assertEquals(false, g(0));
+  assertEquals(true, g(1));
+  assertEquals(false, g(2));
+  assertEquals(false, g(3));
+  assertEquals(false, g(4));
+  %OptimizeFunctionOnNextCall(g);
+  assertEquals(false, g(-1));
+  assertEquals(false, g(0));
+  assertEquals(true, g(1));
+  assertEquals(false, g(2));
+  assertEquals(false, g(3));
+  assertEquals(false, g(4));
+  assertOptimized(g);
+})();
+
+(function() {
+  function g(n) { return "cba".endsWith("a", n); }
+
+  %PrepareFunctionForOptimization(g);
+  assertEquals(true, g());
+  assertEquals(true, g(undefined));
+  assertEquals(false, g(2));
+  assertEquals(true, g(3));
+  assertEquals(true, g(100));
+  %OptimizeFunctionOnNextCall(g);
+  assertEquals(true, g());
+  assertEquals(true, g(undefined));
+  assertEquals(false, g(2));
+  assertEquals(true, g(3));
+  assertEquals(true, g(100));
+  assertOptimized(g);
+})();
+
+(function() {
+  function g(n) { return "cba".endsWith("a", n); }
+  %PrepareFunctionForOptimization(g);
+  g();
+  g();
+  %OptimizeFunctionOnNextCall(g);
+  // Not a Smi with pointer compression, so this may deoptimize.
+  assertEquals(true, g(1073741824));
+})();
+
+(function() {
+  function f() { return "abc".endsWith(""); }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(true, f());
+  assertEquals(true, f());
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(true, f());
+  assertOptimized(f);
+})();
@@ -0,0 +1,77 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan
+
+(function() {
+  function foo(string) { return string.split(','); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals([''], foo(''));
+  assertEquals(['a', 'b', 'c'], foo('a,b,c'));
+  assertEquals(['', ''], foo(','));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals([''], foo(''));
+  assertEquals(['a', 'b', 'c'], foo('a,b,c'));
+  assertEquals(['', ''], foo(','));
+  assertEquals(['Ш', 'Щ'], foo('Ш,Щ'));
+  assertOptimized(foo);
+})();
+
+(function() {
+  function foo(string) { return string.split(',', undefined); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  assertOptimized(foo);
+})();
+
+(function() {
+  function foo(string) { return string.split(','); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  assertOptimized(foo);
+  // A non-string receiver deopts.
+  assertEquals(['1', '2'], foo({ split: String.prototype.split,
+                                 toString() { return '1,2'; } }));
+  assertUnoptimized(foo);
+})();
+
+(function() {
+  function foo(string) {
+    try {
+      return string.split(',');
+    } catch (e) {
+      return e;
+    }
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  assertOptimized(foo);
+})();
+
+(function() {
+  function foo(string) { return string.split(','); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(['a', 'b'], foo('a,b'));
+  assertOptimized(foo);
+
+  // Installing @@split on the separator's prototype chain invalidates the
+  // optimized code.
+  String.prototype[Symbol.split] = function(s) { return 'split'; };
+  assertUnoptimized(foo);
+  assertEquals('split', foo('a,b'));
+  delete String.prototype[Symbol.split];
+})();
@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings long enough to be scanned in blocks, with the special characters
+// at every position relative to the block boundaries.
+
+const long = 'abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ';
+
+for (let i = 0; i < long.length; i++) {
+  const prefix = long.substring(0, i);
+  const suffix = long.substring(i);
+  assertEquals(long, JSON.parse(`"${long}"`));
+  assertEquals(prefix + '"' + suffix, JSON.parse(`"${prefix}\\"${suffix}"`));
+  assertEquals(prefix + '\\' + suffix, JSON.parse(`"${prefix}\\\\${suffix}"`));
+  assertEquals(prefix + '\n' + suffix, JSON.parse(`"${prefix}\\n${suffix}"`));
+  assertThrows(() => JSON.parse(`"${prefix}\n${suffix}"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}\x01${suffix}"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+
+  // Two-byte input, with and without characters outside Latin1.
+  const two_byte = prefix + '\u2028' + suffix;
+  assertEquals(two_byte, JSON.parse(`"${two_byte}"`));
+  assertEquals(two_byte, JSON.parse(`"${prefix}\\u2028${suffix}"`));
+  const latin1 = prefix + '\xff' + suffix;
+  assertEquals(
+      [latin1, two_byte], JSON.parse(`["${latin1}", "${two_byte}"]`));
+}
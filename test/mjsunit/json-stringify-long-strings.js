@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings long enough to be copied in blocks, with characters that need
+// escaping at every position relative to the block boundaries.
+
+const long = 'abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ';
+
+for (let i = 0; i <= long.length; i++) {
+  const prefix = long.substring(0, i);
+  const suffix = long.substring(i);
+  assertEquals(`"${long}"`, JSON.stringify(long));
+  assertEquals(`"${prefix}\\"${suffix}"`,
+               JSON.stringify(prefix + '"' + suffix));
+  assertEquals(`"${prefix}\\\\${suffix}"`,
+               JSON.stringify(prefix + '\\' + suffix));
+  assertEquals(`"${prefix}\\n${suffix}"`,
+               JSON.stringify(prefix + '\n' + suffix));
+  assertEquals(`"${prefix}\x7f${suffix}"`,
+               JSON.stringify(prefix + '\x7f' + suffix));
+  assertEquals(`"${prefix} !${suffix}"`,
+               JSON.stringify(prefix + ' !' + suffix));
+  assertEquals(`"${prefix}\xff${suffix}"`,
+               JSON.stringify(prefix + '\xff' + suffix));
+  assertEquals(`{"${prefix}\\t${suffix}":1}`,
+               JSON.stringify({[prefix + '\t' + suffix]: 1}));
+}
@@ -0,0 +1,79 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The stringifier remembers maps without a toJSON property; make sure that
+// changes to the prototype chain during stringification are still observed.
+
+(function TestToJSONAddedToPrototype() {
+  function Record(x) { this.x = x; }
+  const records = [new Record(1), new Record(2), new Record(3)];
+  Object.defineProperty(records[1], 'y', {
+    get() {
+      Record.prototype.toJSON = function() { return 'record'; };
+      return 0;
+    },
+    enumerable: true
+  });
+  assertEquals('[{"x":1},{"x":2,"y":0},"record"]', JSON.stringify(records));
+  assertEquals('["record","record","record"]', JSON.stringify(records));
+})();
+
+(function TestToJSONAddedToObjectPrototype() {
+  const records = [{a: 1}, {a: 2}, {a: 3}];
+  let added = false;
+  records[1] = {get a() {
+    Object.prototype.toJSON = function() { return 'object'; };
+    added = true;
+    return 2;
+  }};
+  try {
+    assertEquals('[{"a":1},{"a":2},"object"]', JSON.stringify(records));
+    assertTrue(added);
+  } finally {
+    delete Object.prototype.toJSON;
+  }
+  assertEquals('[{"a":1},{"a":2},{"a":3}]',
+               JSON.stringify([{a: 1}, {a: 2}, {a: 3}]));
+})();
+
+(function TestToJSONOnDictionaryPrototype() {
+  const proto = {};
+  for (let i = 0; i < 100; i++) proto['p' + i] = i;
+  for (let i = 0; i < 100; i++) delete proto['p' + i];
+  const records = [];
+  for (let i = 0; i < 4; i++) {
+    const record = Object.create(proto);
+    record.v = i;
+    records.push(record);
+  }
+  records.splice(2, 0, {get v() {
+    proto.toJSON = function() { return this.v; };
+    return 'getter';
+  }});
+  assertEquals('[{"v":0},{"v":1},{"v":"getter"},2,3]', JSON.stringify(records));
+})();
+
+(function TestToJSONAddedWhileSameMapIsCached() {
+  function getter() {
+    if (this.i === 5) {
+      Object.getPrototypeOf(this).toJSON = function() { return this.i; };
+    }
+    return 0;
+  }
+  function Row(i) {
+    this.i = i;
+    Object.defineProperty(this, 'g', {get: getter, enumerable: true});
+  }
+  const rows = [];
+  for (let i = 0; i < 8; i++) rows.push(new Row(i));
+  // All rows share one map, so rows 1 to 5 skip the toJSON lookup.
+  for (let i = 1; i < rows.length; i++) {
+    assertTrue(%HaveSameMap(rows[0], rows[i]));
+  }
+  assertEquals('[{"i":0,"g":0},{"i":1,"g":0},{"i":2,"g":0},{"i":3,"g":0},' +
+                   '{"i":4,"g":0},{"i":5,"g":0},6,7]',
+               JSON.stringify(rows));
+})();
@@ -0,0 +1,24 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Comments are skipped with wide search loops; check that the terminating
+// characters are found at every offset within a chunk.
+
+const kTerminators = ["\n", "\r", "\u2028", "\u2029"];
+
+for (let i = 0; i < 40; i++) {
+  const padding = "x".repeat(i);
+  for (const terminator of kTerminators) {
+    // The line terminator ends the single-line comment, so the assignment
+    // after it is executed.
+    assertEquals(1, eval(`var a = 0; //${padding}${terminator}a = 1; a`));
+  }
+  // A "*" that is not followed by "/" does not end a multi-line comment.
+  assertEquals(2, eval(`var b = 2; /*\n${padding}* b = 3; */ b`));
+  assertEquals(
+      3, eval(`var c = 3; /*\n${padding}*${padding}*/ c`));
+  assertThrows(() => eval(`/*\n${padding}*`), SyntaxError);
+  // U+2027 and U+202A are not line terminators.
+  assertEquals(4, eval(`var d = 4; //${padding}\u2027d = 5;\u202A\nd`));
+}
@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-stress-opt
+// Flags: --no-always-turbofan
+
+function a() { return 1; }
+function b() { return 2; }
+
+function foo(f) {
+  return f() + 10;
+}
+
+%PrepareFunctionForOptimization(a);
+%PrepareFunctionForOptimization(b);
+%PrepareFunctionForOptimization(foo);
+assertEquals(11, foo(a));
+assertEquals(11, foo(a));
+
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(11, foo(a));
+assertTrue(isMaglevved(foo));
+
+// The call site was inlined for |a|; calling with a different target has to
+// deopt rather than run the inlined body.
+assertEquals(12, foo(b));
+assertFalse(isMaglevved(foo));
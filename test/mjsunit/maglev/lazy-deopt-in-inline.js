@@ -0,0 +1,41 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-stress-opt
+// Flags: --no-always-turbofan
+
+var x = 1;
+var do_change = false;
+
+function g() {
+  if (do_change) {
+    x = 2;
+    return 40;
+  }
+  return 30;
+}
+
+function inner() {
+  return g() + x;
+}
+
+function outer() {
+  return 100 + inner();
+}
+
+%PrepareFunctionForOptimization(g);
+%PrepareFunctionForOptimization(inner);
+%PrepareFunctionForOptimization(outer);
+assertEquals(131, outer());
+assertEquals(131, outer());
+
+%OptimizeMaglevOnNextCall(outer);
+assertEquals(131, outer());
+assertTrue(isMaglevved(outer));
+
+// Trigger a lazy deopt on the g() call inside the inlined inner function. Both
+// the inner and the outer frame have to be materialized.
+do_change = true;
+assertEquals(142, outer());
+assertUnoptimized(outer);
@@ -0,0 +1,33 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-stress-opt --no-always-turbofan
+
+var change_shape = false;
+
+function g(o) {
+  if (change_shape) {
+    delete o.x;
+    o.x = 5;
+  }
+}
+
+// The second load of o.x reuses the map check of the first one, but the call
+// in between must invalidate it.
+function f(o) {
+  var a = o.x + o.y;
+  g(o);
+  return a + o.x;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(4, f({x: 1, y: 2}));
+assertEquals(4, f({x: 1, y: 2}));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(4, f({x: 1, y: 2}));
+assertTrue(isMaglevved(f));
+
+change_shape = true;
+assertEquals(8, f({x: 1, y: 2}));
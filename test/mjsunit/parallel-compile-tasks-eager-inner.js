@@ -0,0 +1,39 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-compile-dispatcher --parallel-compile-tasks-for-eager-inner
+// Flags: --use-external-strings
+
+// Mimics a bundle: module bodies are eagerly compiled IIFEs nested in a
+// top-level closure.
+(function(modules) {
+  var outer_var = 42;
+
+  var a = (function(x) {
+    assertEquals(outer_var, 42);
+    return x + 1;
+  })(1);
+  assertEquals(a, 2);
+
+  var b = (function(x, ...rest) {
+    return (function() { return x + rest.length + outer_var; })();
+  })(1, 2, 3);
+  assertEquals(b, 45);
+
+  var gen = (function*() {
+    yield outer_var;
+  })();
+  assertEquals(gen.next().value, 42);
+
+  var result = (function recursive(n = 0) {
+    if (n == 1) return outer_var;
+    return recursive(1);
+  })();
+  assertEquals(result, 42);
+
+  // Not called, so it is only compiled by the dispatcher.
+  (function() { class foo {}; });
+
+  for (var m of modules) m();
+})([function() { assertEquals(1, 1); }]);
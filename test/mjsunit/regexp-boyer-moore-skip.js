@@ -0,0 +1,27 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long subjects exercise the block-wise skip loop that the Boyer-Moore
+// lookahead may emit in front of its character-by-character loop.
+
+function test(filler) {
+  const patterns = [/...x/, /[^]{4}x/, /x/, /...x/i, /.....\u0178/];
+  const targets = ['x', 'x', 'x', 'X', '\u0178'];
+  for (let p = 0; p < patterns.length; p++) {
+    const re = patterns[p];
+    for (let i = 5; i < 100; i++) {
+      const subject = filler.repeat(i) + targets[p] + filler.repeat(40);
+      const match = re.exec(subject);
+      assertNotNull(match, `${re} at ${i}`);
+      assertEquals(i + 1, match.index + match[0].length, `${re} at ${i}`);
+      // A character that only matches after masking must not be taken.
+      assertNull(re.exec(filler.repeat(i) + '\xf8' + filler.repeat(40)));
+    }
+    assertNull(re.exec(filler.repeat(200)));
+  }
+}
+
+test('a');
+test('\u0100');
+test('\xe9');
@@ -0,0 +1,31 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global replacements of non-atom regexps with a replacement string that
+// contains no '$' patterns.
+
+assertEquals("xbxxx", "abaca".replace(/[ac]/g, "x"));
+assertEquals("-a-b-c-", "abc".replace(/(?:)/g, "-"));
+assertEquals("", "aaaa".replace(/a+/g, ""));
+assertEquals("QQ", "aaaa".replace(/a{2}/g, "Q"));
+assertEquals("noop", "noop".replace(/z+/g, "Q"));
+
+// Two-byte replacement into a one-byte subject and vice versa.
+assertEquals("\u0100b\u0100", "aba".replace(/a|c/g, "\u0100"));
+assertEquals("xbx", "\u0100b\u0101".replace(/[\u0100-\u0101]/g, "x"));
+
+// Replacement growing the string.
+var subject = "ab".repeat(1000);
+var result = subject.replace(/a(b)/g, "long");
+assertEquals("long".repeat(1000), result);
+
+// The last match info is still updated.
+"foo1bar22baz".replace(/(\d)+/g, "#");
+assertEquals("22", RegExp.lastMatch);
+assertEquals("2", RegExp.$1);
+assertEquals("foo1bar", RegExp.leftContext);
+assertEquals("baz", RegExp.rightContext);
+
+// Unicode regexps advance over surrogate pairs.
+assertEquals("-\u{1F600}-", "\u{1F600}".replace(/(?:)/gu, "-"));
@@ -0,0 +1,41 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Equality of long cons strings that are compared without being flattened.
+
+function makeRope(parts) {
+  let s = "";
+  for (let p of parts) s += p;
+  return s;
+}
+
+let chunk = "abcdefghijklmnopqrstuvwxyz0123456789";
+let parts = [];
+for (let i = 0; i < 500; i++) parts.push(chunk + i);
+
+let a = makeRope(parts);
+let b = makeRope(parts);
+assertTrue(a === b);
+assertTrue(a == b);
+assertEquals(0, a.localeCompare(b));
+
+// Differences at the very end of the rope.
+let c = makeRope(parts) + "x";
+let d = makeRope(parts) + "y";
+assertFalse(c === d);
+assertTrue(c < d);
+
+// One flat and one rope operand.
+let flat = a.split("").join("");
+assertTrue(flat === b);
+
+// Mixed one-byte and two-byte leaves.
+let wide = makeRope(parts.map((p, i) => i % 7 ? p : p + "\u0100"));
+let wide2 = makeRope(parts.map((p, i) => i % 7 ? p : p + "\u0100"));
+let narrow = makeRope(parts.map((p, i) => i % 7 ? p : p + "\u00ff"));
+assertTrue(wide === wide2);
+assertFalse(wide === narrow);
+
+let m = new Map([[a, 1]]);
+assertEquals(1, m.get(b));
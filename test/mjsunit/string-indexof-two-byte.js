@@ -0,0 +1,35 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searching for a single character in two-byte subjects, at every position
+// relative to the vectorized block boundaries.
+
+for (let len = 1; len < 40; len++) {
+  for (let pos = 0; pos < len; pos++) {
+    let chars = new Array(len).fill("\u4e00");
+    chars[pos] = "\u4e01";
+    let subject = chars.join("");
+    assertEquals(pos, subject.indexOf("\u4e01"));
+    assertEquals(pos, subject.indexOf("\u4e01", pos));
+    assertEquals(-1, subject.indexOf("\u4e01", pos + 1));
+    // Characters sharing the high byte with the subject must not match.
+    assertEquals(-1, subject.indexOf("\u4e02"));
+  }
+}
+
+// One-byte search character in a two-byte subject.
+let mixed = "\u0100".repeat(17) + "a" + "\u0161".repeat(5) + "a";
+assertEquals(17, mixed.indexOf("a"));
+assertEquals(23, mixed.indexOf("a", 18));
+assertEquals(-1, mixed.indexOf("a", 24));
+
+// The zero character.
+let zeros = "\u0100".repeat(30) + "\0";
+assertEquals(30, zeros.indexOf("\0"));
+assertEquals(-1, ("\u0100".repeat(30)).indexOf("\0"));
+
+// Multi-character patterns start with a first-character scan as well.
+let text = "\u4e00\u4e01".repeat(20) + "\u4e02\u4e03";
+assertEquals(40, text.indexOf("\u4e02\u4e03"));
+assertEquals(-1, text.indexOf("\u4e03\u4e02"));
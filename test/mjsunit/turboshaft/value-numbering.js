@@ -0,0 +1,32 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --turboshaft-value-numbering --allow-natives-syntax
+
+function f(x, y) {
+  x = x | 0;
+  y = y | 0;
+  return ((x + y) | 0) * ((x + y) | 0) + ((x ^ y) - (x ^ y));
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(25, f(2, 3));
+assertEquals(49, f(2, 5));
+
+%OptimizeFunctionOnNextCall(f);
+assertEquals(25, f(2, 3));
+assertEquals(49, f(2, 5));
+assertEquals(0, f(-4, 4));
+
+// 0 and -0 are different constants and must not be merged.
+function g(x) {
+  x = +x;
+  return [1 / (x * 0), 1 / (x * -0)];
+}
+
+%PrepareFunctionForOptimization(g);
+assertEquals([Infinity, -Infinity], g(1.5));
+%OptimizeFunctionOnNextCall(g);
+assertEquals([Infinity, -Infinity], g(1.5));
+assertEquals([-Infinity, Infinity], g(-1.5));
@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// indexOf and includes on TypedArrays on plain and shared buffers, with the
+// match at every position of a medium-sized array.
+
+const ctors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+
+for (let ctor of ctors) {
+  for (let buffer_ctor of [ArrayBuffer, SharedArrayBuffer]) {
+    const length = 40;
+    const ta = new ctor(new buffer_ctor(length * ctor.BYTES_PER_ELEMENT));
+    ta.fill(1);
+    assertEquals(-1, ta.indexOf(5));
+    assertFalse(ta.includes(5));
+    for (let i = 0; i < length; i++) {
+      ta[i] = 5;
+      assertEquals(i, ta.indexOf(5));
+      assertEquals(i, ta.indexOf(5, i));
+      assertEquals(-1, ta.indexOf(5, i + 1));
+      assertTrue(ta.includes(5));
+      assertTrue(ta.includes(5, i));
+      assertFalse(ta.includes(5, i + 1));
+      ta[i] = 1;
+    }
+    assertEquals(-1, ta.indexOf(1, length));
+    assertEquals(0, ta.indexOf(1, -length - 1));
+  }
+}
+
+// Negative values in signed single-byte arrays.
+const i8 = new Int8Array([0, 1, -1, 127, -128]);
+assertEquals(2, i8.indexOf(-1));
+assertEquals(4, i8.indexOf(-128));
+assertEquals(-1, i8.indexOf(255));
+assertFalse(i8.includes(255));
+
+// Values that cannot be represented in the element type.
+const u8 = new Uint8Array([0, 255, 1]);
+assertEquals(-1, u8.indexOf(-1));
+assertEquals(-1, u8.indexOf(1.5));
+assertEquals(1, u8.indexOf(255));
+
+// Signed zero and NaN in float arrays.
+const f64 = new Float64Array([1, -0, NaN]);
+assertEquals(1, f64.indexOf(0));
+assertEquals(-1, f64.indexOf(NaN));
+assertTrue(f64.includes(NaN));
+assertTrue(f64.includes(-0));
@@ -0,0 +1,84 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// memory.copy and memory.fill with small constant sizes are compiled inline
+// by TurboFan; check that they behave like the out-of-line versions.
+const kSizes = [1, 2, 3, 4, 8];
+
+function instantiate(memory) {
+  const builder = new WasmModuleBuilder();
+  builder.addImportedMemory('m', 'memory', 1);
+  for (const size of kSizes) {
+    builder.addFunction('copy' + size, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0,  // Dest.
+          kExprLocalGet, 1,  // Source.
+          ...wasmI32Const(size),
+          kNumericPrefix, kExprMemoryCopy, 0, 0,
+        ])
+        .exportFunc();
+    builder.addFunction('fill' + size, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0,  // Dest.
+          kExprLocalGet, 1,  // Byte value.
+          ...wasmI32Const(size),
+          kNumericPrefix, kExprMemoryFill, 0,
+        ])
+        .exportFunc();
+  }
+  return builder.instantiate({m: {memory}}).exports;
+}
+
+(function TestConstantSizeMemoryCopy() {
+  const memory = new WebAssembly.Memory({initial: 1});
+  const view = new Uint8Array(memory.buffer);
+  const exports = instantiate(memory);
+  for (const size of kSizes) {
+    for (let i = 0; i < 16; ++i) view[i] = i + 1;
+    // Overlapping copy, unaligned on both ends.
+    exports['copy' + size](3, 1);
+    for (let i = 0; i < 16; ++i) {
+      const expected = i >= 3 && i < 3 + size ? i - 1 : i + 1;
+      assertEquals(expected, view[i]);
+    }
+
+    // Out of bounds traps without writing anything.
+    view.fill(0);
+    view[kPageSize - 1] = 42;
+    assertTraps(
+        kTrapMemOutOfBounds, () => exports['copy' + size](kPageSize, 0));
+    if (size > 1) {
+      assertTraps(kTrapMemOutOfBounds,
+                  () => exports['copy' + size](0, kPageSize - 1));
+      assertEquals(0, view[0]);
+      exports['copy' + size](kPageSize - size, 0);
+      assertEquals(0, view[kPageSize - 1]);
+    }
+  }
+})();
+
+(function TestConstantSizeMemoryFill() {
+  const memory = new WebAssembly.Memory({initial: 1});
+  const view = new Uint8Array(memory.buffer);
+  const exports = instantiate(memory);
+  for (const size of kSizes) {
+    view.fill(0, 0, 16);
+    // Only the low byte of the value is used.
+    exports['fill' + size](5, 0x1ab);
+    for (let i = 0; i < 16; ++i) {
+      assertEquals(i >= 5 && i < 5 + size ? 0xab : 0, view[i]);
+    }
+
+    assertTraps(kTrapMemOutOfBounds,
+                () => exports['fill' + size](kPageSize - size + 1, 1));
+    assertEquals(0, view[kPageSize - 1]);
+    exports['fill' + size](kPageSize - size, 7);
+    assertEquals(7, view[kPageSize - 1]);
+    view[kPageSize - 1] = 0;
+  }
+})();
@@ -0,0 +1,80 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-lazy-compile-callees
+// Flags: --allow-natives-syntax --liftoff
+
+// This test busy-waits for background compilation, hence it does not work in
+// predictable mode where we only have a single thread.
+// Flags: --no-predictable
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testCallGraph() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const imp = builder.addImport('m', 'imp', kSig_i_i);
+  const leaf = builder.addFunction('leaf', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add
+  ]);
+  const mid = builder.addFunction('mid', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprCallFunction, leaf.index,
+    kExprCallFunction, imp
+  ]);
+  // {leaf} is a callee of both {main} and {mid}.
+  builder.addFunction('main', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprCallFunction, mid.index,
+    kExprCallFunction, mid.index,
+    kExprCallFunction, leaf.index
+  ]).exportFunc();
+  const instance = builder.instantiate({m: {imp: x => x * 2}});
+  assertEquals(7, instance.exports.main(0));
+  assertEquals(11, instance.exports.main(1));
+})();
+
+(function testManyCallees() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const kNumCallees = 50;
+  const callees = [];
+  for (let i = 0; i < kNumCallees; ++i) {
+    callees.push(builder.addFunction('f' + i, kSig_i_v).addBody([
+      ...wasmI32Const(i)
+    ]));
+  }
+  const body = [kExprI32Const, 0];
+  for (const callee of callees) {
+    body.push(kExprCallFunction, callee.index, kExprI32Add);
+  }
+  builder.addFunction('sum', kSig_i_v).addBody(body).exportFunc();
+  const instance = builder.instantiate();
+  for (let i = 0; i < 3; ++i) {
+    assertEquals(kNumCallees * (kNumCallees - 1) / 2, instance.exports.sum());
+  }
+})();
+
+(function testCalleesAreCompiledInBackground() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const callee = builder.addFunction('callee', kSig_i_v)
+                     .addBody(wasmI32Const(3))
+                     .exportFunc();
+  // {callee} is only reached if the argument is non-zero.
+  builder.addFunction('caller', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprIf, kWasmI32,
+          kExprCallFunction, callee.index,
+        kExprElse,
+          kExprI32Const, 0,
+        kExprEnd
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  const hasCode = f => %IsLiftoffFunction(f) || %IsTurboFanFunction(f);
+  assertFalse(hasCode(instance.exports.callee));
+  // Compiling {caller} queues {callee}, which is never called here.
+  assertEquals(0, instance.exports.caller(0));
+  while (!hasCode(instance.exports.callee)) {}
+  assertEquals(3, instance.exports.caller(1));
+})();
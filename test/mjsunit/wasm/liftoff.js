@@ -34,6 +34,29 @@ d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
   assertTrue(%IsLiftoffFunction(instance.exports.i32_add));
 })();
 
+(function testLiftoffI32SubImmediate() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  for (const imm of [1, -1, 0x7fffffff, -0x80000000]) {
+    // Keep the parameter alive after the subtraction, so that the result is
+    // computed into a different register than the input.
+    builder.addFunction('sub_' + (imm >>> 0), kSig_i_i)
+        .addBody([
+          kExprLocalGet, 0, ...wasmI32Const(imm), kExprI32Sub,
+          kExprLocalGet, 0, kExprI32Xor
+        ])
+        .exportFunc();
+  }
+  const instance = builder.instantiate();
+  for (const imm of [1, -1, 0x7fffffff, -0x80000000]) {
+    const fn = instance.exports['sub_' + (imm >>> 0)];
+    assertTrue(%IsLiftoffFunction(fn));
+    for (const x of [0, 1, -1, 17, 0x7fffffff, -0x80000000]) {
+      assertEquals(((x - imm) | 0) ^ x, fn(x));
+    }
+  }
+})();
+
 async function testLiftoffAsync() {
   print(arguments.callee.name);
   const builder = new WasmModuleBuilder();
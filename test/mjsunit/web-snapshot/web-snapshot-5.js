@@ -87,3 +87,35 @@ d8.file.execute('test/mjsunit/web-snapshot/web-snapshot-helpers.js');
   const obj = new MyError();
   assertTrue(obj.__proto__.__proto__ === Realm.eval(realm, "Error.prototype"));
 })();
+
+(function TestMap() {
+  function createObjects() {
+    const obj = {a: 1};
+    globalThis.foo = new Map([['x', 1], [obj, 'obj'], [2, [obj]]]);
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertTrue(foo instanceof Map);
+  assertEquals(3, foo.size);
+  assertEquals(1, foo.get('x'));
+  const keys = [...foo.keys()];
+  assertEquals(['x', {a: 1}, 2], keys);
+  assertEquals('obj', foo.get(keys[1]));
+  assertSame(keys[1], foo.get(2)[0]);
+})();
+
+(function TestSet() {
+  function createObjects() {
+    const inner = new Set([1, 'two']);
+    globalThis.foo = new Set([inner, 3.5, 'str']);
+    foo.add(foo);
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertTrue(foo instanceof Set);
+  assertEquals(4, foo.size);
+  assertTrue(foo.has(3.5));
+  assertTrue(foo.has('str'));
+  assertTrue(foo.has(foo));
+  const inner = [...foo][0];
+  assertTrue(inner instanceof Set);
+  assertEquals([1, 'two'], [...inner]);
+})();
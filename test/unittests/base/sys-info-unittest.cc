@@ -16,6 +16,11 @@ TEST(SysInfoTest, AmountOfPhysicalMemory) {
   EXPECT_LT(0, SysInfo::AmountOfPhysicalMemory());
 }
 
+TEST(SysInfoTest, AmountOfPhysicalMemoryAvailableToProcess) {
+  const int64_t available = SysInfo::AmountOfPhysicalMemoryAvailableToProcess();
+  EXPECT_LT(0, available);
+  EXPECT_LE(available, SysInfo::AmountOfPhysicalMemory());
+}
 
 TEST(SysInfoTest, AmountOfVirtualMemory) {
   EXPECT_LE(0, SysInfo::AmountOfVirtualMemory());
@@ -17,6 +17,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/promise-inl.h"
 #include "src/objects/visitors.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -249,6 +250,28 @@ TEST_P(MicrotaskQueueTest, VisitRoot) {
   EXPECT_EQ(expected, actual);
 }
 
+// An idle queue keeps --microtask-queue-retained-capacity slots across GCs
+// instead of shrinking back to kMinimumCapacity.
+TEST_P(MicrotaskQueueTest, RetainedCapacity) {
+  FlagScope<int> retained_capacity(
+      &FLAG_microtask_queue_retained_capacity,
+      static_cast<int>(MicrotaskQueue::kMinimumCapacity * 4));
+  for (int i = 0; i < MicrotaskQueue::kMinimumCapacity * 8; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([] {}));
+  }
+  EXPECT_EQ(MicrotaskQueue::kMinimumCapacity * 8,
+            microtask_queue()->capacity());
+  microtask_queue()->RunMicrotasks(isolate());
+
+  RecordingVisitor visitor;
+  microtask_queue()->IterateMicrotasks(&visitor);
+  EXPECT_EQ(MicrotaskQueue::kMinimumCapacity * 4,
+            microtask_queue()->capacity());
+  microtask_queue()->IterateMicrotasks(&visitor);
+  EXPECT_EQ(MicrotaskQueue::kMinimumCapacity * 4,
+            microtask_queue()->capacity());
+}
+
 TEST_P(MicrotaskQueueTest, PromiseHandlerContext) {
   microtask_queue()->set_microtasks_policy(MicrotasksPolicy::kExplicit);
   Local<v8::Context> v8_context2 = v8::Context::New(v8_isolate());
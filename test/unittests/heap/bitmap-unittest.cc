@@ -158,5 +158,34 @@ TEST_F(NonAtomicBitmapTest, ClearMultipleRanges) {
                                 Bitmap::kBitsPerCell * 3));
 }
 
+TEST_F(NonAtomicBitmapTest, LongRanges) {
+  auto bm = this->bitmap();
+  // Ranges spanning many cells are checked in blocks of cells. Cover ranges
+  // whose only deviating bit is in a block or in the cells after the last
+  // full block.
+  const uint32_t kCells = 21;
+  const uint32_t kEnd = kCells * Bitmap::kBitsPerCell;
+  CHECK(bm->AllBitsClearInRange(1, kEnd));
+  for (uint32_t index : {uint32_t{Bitmap::kBitsPerCell * 4 + 3},
+                         uint32_t{Bitmap::kBitsPerCell * 19 + 30}}) {
+    bm->SetRange(index, index + 1);
+    CHECK(!bm->AllBitsClearInRange(1, kEnd));
+    CHECK(!bm->IsClean());
+    bm->ClearRange(index, index + 1);
+    CHECK(bm->AllBitsClearInRange(1, kEnd));
+    CHECK(bm->IsClean());
+  }
+
+  bm->SetRange(0, kEnd);
+  CHECK(bm->AllBitsSetInRange(1, kEnd - 1));
+  for (uint32_t index : {uint32_t{Bitmap::kBitsPerCell * 4 + 3},
+                         uint32_t{Bitmap::kBitsPerCell * 19 + 30}}) {
+    bm->ClearRange(index, index + 1);
+    CHECK(!bm->AllBitsSetInRange(1, kEnd - 1));
+    bm->SetRange(index, index + 1);
+    CHECK(bm->AllBitsSetInRange(1, kEnd - 1));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
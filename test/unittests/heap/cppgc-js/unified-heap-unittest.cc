@@ -24,6 +24,7 @@
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/sweeper.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/cppgc-js/unified-heap-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 
@@ -131,6 +132,53 @@ TEST_F(UnifiedHeapTest, FreeUnreferencedDuringNoGcScope) {
 }
 #endif  // DEBUG
 
+#if defined(CPPGC_YOUNG_GENERATION)
+namespace {
+class YoungObject final : public cppgc::GarbageCollected<YoungObject> {
+ public:
+  static size_t destructor_callcount;
+
+  ~YoungObject() { destructor_callcount++; }
+
+  void Trace(cppgc::Visitor*) const {}
+};
+
+size_t YoungObject::destructor_callcount = 0;
+
+V8_NOINLINE void AllocateUnreachableYoungObject(
+    cppgc::AllocationHandle& allocation_handle) {
+  cppgc::MakeGarbageCollected<YoungObject>(allocation_handle);
+}
+}  // namespace
+
+TEST_F(UnifiedHeapTest, DeferredMinorGCReclaimsYoungObject) {
+  FlagScope<bool> young_generation(&FLAG_cppgc_young_generation, true);
+  // The young generation is enabled at the end of the next full GC.
+  CollectGarbageWithoutEmbedderStack();
+  ASSERT_TRUE(cpp_heap().generational_gc_supported());
+  while (v8::platform::PumpMessageLoop(
+      V8::GetCurrentPlatform(), v8_isolate(),
+      v8::platform::MessageLoopBehavior::kDoNotWait)) {
+  }
+  YoungObject::destructor_callcount = 0;
+  AllocateUnreachableYoungObject(allocation_handle());
+
+  // A scavenge that is not run from a task may find heap pointers on the stack
+  // and skips the cppgc minor GC.
+  CollectGarbage(NEW_SPACE);
+  cpp_heap().sweeper().FinishIfRunning();
+  EXPECT_EQ(0u, YoungObject::destructor_callcount);
+
+  // The scavenge task it requested runs the minor GC.
+  while (v8::platform::PumpMessageLoop(
+      V8::GetCurrentPlatform(), v8_isolate(),
+      v8::platform::MessageLoopBehavior::kDoNotWait)) {
+  }
+  cpp_heap().sweeper().FinishIfRunning();
+  EXPECT_EQ(1u, YoungObject::destructor_callcount);
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 TEST_F(UnifiedHeapTest, TracedReferenceRetainsFromStack) {
   v8::HandleScope handle_scope(v8_isolate());
   v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
@@ -130,6 +130,18 @@ TEST_F(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling) {
   EXPECT_GE(heap->external_memory_limit(), kExternalAllocationSoftLimit);
 }
 
+TEST_F(HeapTest, GCPauseBudget) {
+  Heap* heap = i_isolate()->heap();
+  EXPECT_EQ(0.0, heap->gc_pause_budget_in_ms());
+  EXPECT_EQ(0.0, heap->gc_target_mutator_utilization());
+  v8_isolate()->SetGCPauseBudget(2.5, 0.75);
+  EXPECT_EQ(2.5, heap->gc_pause_budget_in_ms());
+  EXPECT_EQ(0.75, heap->gc_target_mutator_utilization());
+  v8_isolate()->SetGCPauseBudget(0, 0);
+  EXPECT_EQ(0.0, heap->gc_pause_budget_in_ms());
+  EXPECT_EQ(0.0, heap->gc_target_mutator_utilization());
+}
+
 #ifdef V8_COMPRESS_POINTERS
 TEST_F(HeapTest, HeapLayout) {
   // Produce some garbage.
@@ -0,0 +1,70 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/backing-store.h"
+
+#include <memory>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+std::unique_ptr<v8::ArrayBuffer::Allocator> NewDefaultAllocator() {
+  return std::unique_ptr<v8::ArrayBuffer::Allocator>(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+}
+
+}  // namespace
+
+TEST(PoolingArrayBufferAllocatorTest, ReusesFreedBlocks) {
+  auto underlying = NewDefaultAllocator();
+  PoolingArrayBufferAllocator pool(underlying.get(), nullptr, 64 * KB);
+
+  uint8_t* data = static_cast<uint8_t*>(pool.Allocate(5 * KB));
+  ASSERT_NE(nullptr, data);
+  data[0] = 42;
+  pool.Free(data, 5 * KB);
+  EXPECT_EQ(8 * KB, pool.pooled_bytes());
+
+  // A length of the same size class gets the pooled block back, and it is
+  // zero-initialized again.
+  uint8_t* reused = static_cast<uint8_t*>(pool.Allocate(7 * KB));
+  EXPECT_EQ(data, reused);
+  EXPECT_EQ(0, reused[0]);
+  EXPECT_EQ(0u, pool.pooled_bytes());
+  EXPECT_EQ(1u, pool.pool_hits());
+  pool.Free(reused, 7 * KB);
+}
+
+TEST(PoolingArrayBufferAllocatorTest, RespectsCap) {
+  auto underlying = NewDefaultAllocator();
+  PoolingArrayBufferAllocator pool(underlying.get(), nullptr, 64 * KB);
+
+  void* first = pool.AllocateUninitialized(64 * KB);
+  void* second = pool.AllocateUninitialized(64 * KB);
+  pool.Free(first, 64 * KB);
+  pool.Free(second, 64 * KB);
+  EXPECT_EQ(64 * KB, pool.pooled_bytes());
+
+  pool.ReleasePooledMemory();
+  EXPECT_EQ(0u, pool.pooled_bytes());
+}
+
+TEST(PoolingArrayBufferAllocatorTest, ForwardsUnpooledLengths) {
+  auto underlying = NewDefaultAllocator();
+  PoolingArrayBufferAllocator pool(underlying.get(), nullptr, 1 * MB);
+
+  void* small = pool.Allocate(16);
+  void* large = pool.Allocate(128 * KB);
+  pool.Free(small, 16);
+  pool.Free(large, 128 * KB);
+  EXPECT_EQ(0u, pool.pooled_bytes());
+  EXPECT_EQ(0u, pool.pool_hits());
+}
+
+}  // namespace internal
+}  // namespace v8
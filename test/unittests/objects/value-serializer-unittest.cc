@@ -1360,6 +1360,48 @@ TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
       [this](Local<Value> value) { ExpectScriptTrue("!(0 in result)"); });
 }
 
+TEST_F(ValueSerializerTest, RoundTripDenseNumericArrays) {
+  Local<Value> value = RoundTripTest("[1, -2, 0x3fffffff, -0x40000000, 0]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 5");
+  ExpectScriptTrue(
+      "result.every((x, i) => x === [1, -2, 0x3fffffff, -0x40000000, 0][i])");
+
+  value = RoundTripTest("Array.from({length: 1000}, (_, i) => i + 0.5)");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 1000");
+  ExpectScriptTrue("result.every((x, i) => x === i + 0.5)");
+
+  // Int32 values just outside the 31-bit Smi range.
+  value = RoundTripTest("[0x40000000, 2 ** 31 - 1, -(2 ** 31), 1]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue(
+      "result.every((x, i) => x === [0x40000000, 2 ** 31 - 1, -(2 ** 31), "
+      "1][i])");
+
+  value = RoundTripTest("[0.5, -0, NaN, Infinity, 2 ** 31]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("Object.is(result[1], -0)");
+  ExpectScriptTrue("Number.isNaN(result[2])");
+  ExpectScriptTrue("result[3] === Infinity && result[4] === 2 ** 31");
+}
+
+TEST_F(ValueSerializerTest, DecodeDenseArrayOfInt32OutsideSmiRange) {
+  // Dense array of 0x40000000, 2^31 - 1 and -2^31, written as int32 values.
+  // These need a heap number if Smis are 31 bits.
+  DecodeTestFutureVersions(
+      {0xFF, 0x0D, 0x41, 0x03, 0x49, 0x80, 0x80, 0x80, 0x80, 0x08,
+       0x49, 0xFE, 0xFF, 0xFF, 0xFF, 0x0F, 0x49, 0xFF, 0xFF, 0xFF,
+       0xFF, 0x0F, 0x24, 0x00, 0x03},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        EXPECT_EQ(3u, Array::Cast(*value)->Length());
+        ExpectScriptTrue("result[0] === 0x40000000");
+        ExpectScriptTrue("result[1] === 2 ** 31 - 1");
+        ExpectScriptTrue("result[2] === -(2 ** 31)");
+      });
+}
+
 TEST_F(ValueSerializerTest, RoundTripDate) {
   Local<Value> value = RoundTripTest("new Date(1e6)");
   ASSERT_TRUE(value->IsDate());
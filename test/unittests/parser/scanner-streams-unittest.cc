@@ -383,6 +383,36 @@ TEST_F(ScannerStreamsTest, Utf8ChunkBoundaries) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8LongAsciiRuns) {
+  // Test that ASCII runs longer than a vector are decoded correctly when a
+  // multi-byte character (U+00E9, encoded as 0xC3 0xA9) interrupts them at
+  // every possible offset.
+  const size_t kRunLength = 40;
+  for (size_t i = 0; i < kRunLength; i++) {
+    std::string data(kRunLength, 'a');
+    data.replace(i, 1, "\xC3\xA9");
+    for (size_t j = 0; j < data.size(); j++) {
+      if (data[j] == 'a') data[j] = static_cast<char>('a' + j % 26);
+    }
+    const char* chunks[] = {data.c_str(), "\0"};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+    for (size_t j = 0; j < data.size(); j++) {
+      if (j == i) {
+        CHECK_EQ(0xE9, stream->Advance());
+        j++;
+      } else {
+        CHECK_EQ(data[j], stream->Advance());
+      }
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   // Have each byte as a single-byte chunk.
   size_t len = strlen(unicode_utf8);
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,33 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPoolReusesSegments) {
+  FlagScope<int> pool_size(&FLAG_zone_segment_pool_size, 64);
+  AccountingAllocator allocator;
+  void* first;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first = zone.Allocate<ZoneTestTag>(16);
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_LT(0u, allocator.GetPooledMemory());
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    EXPECT_EQ(first, zone.Allocate<ZoneTestTag>(16));
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
+TEST_F(ZoneTest, SegmentPoolDisabledByDefault) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(16);
+  }
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
 }  // namespace internal
 }  // namespace v8
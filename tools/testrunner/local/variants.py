@@ -111,6 +111,7 @@ INCOMPATIBLE_FLAGS_PER_BUILD_VARIABLE = {
                 "--stress-concurrent-inlining"]
                + INCOMPATIBLE_FLAGS_PER_VARIANT["jitless"],
   "predictable": ["--parallel-compile-tasks-for-eager-toplevel",
+                  "--parallel-compile-tasks-for-eager-inner",
                   "--parallel-compile-tasks-for-lazy",
                   "--concurrent-recompilation",
                   "--stress-concurrent-allocation",
@@ -127,6 +128,7 @@ INCOMPATIBLE_FLAGS_PER_BUILD_VARIABLE = {
 INCOMPATIBLE_FLAGS_PER_EXTRA_FLAG = {
   "--concurrent-recompilation": ["--predictable", "--assert-types"],
   "--parallel-compile-tasks-for-eager-toplevel": ["--predictable"],
+  "--parallel-compile-tasks-for-eager-inner": ["--predictable"],
   "--parallel-compile-tasks-for-lazy": ["--predictable"],
   "--gc-interval=*": ["--gc-interval=*"],
   "--optimize-for-size": ["--max-semi-space-size=*"],